@@ -0,0 +1,74 @@
+#ifndef DEVICE_REGISTRY_H
+#define DEVICE_REGISTRY_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <optional>
+
+/**
+ * @class DeviceRegistry
+ * @brief Owns the robot's configured devices and builds them from the parsed config.
+ *
+ * Devices are constructed in begin(), after ConfigManager.parseConfig(), instead of as globals
+ * whose constructors would run before any config has been read. A drive motor can be moved to
+ * another port at runtime with rebindMotor(); readers fetch the motor through motor() every
+ * time, and holders of motor pointers (the drive's MotorCommandBatch) refresh them when
+ * getGeneration() changes.
+ */
+class DeviceRegistry
+{
+public:
+    using Device = configManager::Device;
+
+    /**
+     * @enum Side
+     * @brief A side of the drivetrain, for the calls that used to go through a motor_group.
+     */
+    enum class Side
+    {
+        Left,
+        Right
+    };
+
+    /// @brief Drive motors in DriveSystem wheel order: front left, rear left, front right, rear right.
+    static constexpr std::array<Device, 4> driveMotors = {Device::FrontLeftMotor, Device::RearLeftMotor, Device::FrontRightMotor, Device::RearRightMotor};
+
+    void begin();
+    bool isReady() const { return ready.load(std::memory_order_acquire); }
+
+    vex::motor &motor(Device device);
+    vex::inertial &inertial();
+    vex::bumper &rearBumper();
+
+    double sideVelocityRpm(Side side);
+    double sidePositionDeg(Side side);
+    void spinSide(Side side, double volts);
+    void stopSide(Side side, vex::brakeType mode);
+
+    bool rebindMotor(Device device, int port);
+    std::uint32_t getGeneration() const { return generation.load(std::memory_order_acquire); }
+
+private:
+    /// A replaced motor must outlive every reader's tick; see DeviceSlot.
+    static constexpr std::uint32_t minRebindIntervalMs = 250;
+
+    /// Motors come first in configManager::Device, so a motor's Device value is its slot.
+    static constexpr std::size_t motorCount = 4;
+
+    void ensureReady();
+    static std::array<Device, 2> sideMotors(Side side);
+
+    std::array<DeviceSlot<vex::motor>, motorCount> motors;
+    std::array<std::uint32_t, motorCount> lastRebindMs{};
+    std::optional<vex::inertial> inertialSensor;
+    std::optional<vex::bumper> bumperSwitch;
+    vex::mutex beginMutex;
+    std::atomic<bool> ready{false};
+    std::atomic<std::uint32_t> generation{0};
+};
+
+/// @brief The robot's devices, valid after ConfigManager.parseConfig().
+extern DeviceRegistry Devices;
+
+#endif /* DEVICE_REGISTRY_H */
@@ -0,0 +1,54 @@
+#ifndef DEVICE_SLOT_H
+#define DEVICE_SLOT_H
+
+#include <array>
+#include <atomic>
+#include <optional>
+#include <utility>
+
+/**
+ * @class DeviceSlot
+ * @brief Holds one device object that can be replaced while other threads use it.
+ *
+ * The slot keeps two buffers. emplace() constructs the new device in the buffer not in use and
+ * publishes it with one atomic store, so readers never lock and never see a half-built object.
+ * The replaced device stays alive until the next emplace(), which is the readers' grace period:
+ * a reader must not keep the pointer from get() across two replacements.
+ *
+ * The slot does not check this itself. It is only safe because the writer spaces its emplace()
+ * calls further apart than any reader holds the pointer: DeviceRegistry::rebindMotor() refuses
+ * to move the same motor again within minRebindIntervalMs, while readers hold it for one control
+ * tick. A new writer must keep such an interval. Values that can be copied should use a SeqLock
+ * instead, which has no such limit.
+ *
+ * @tparam Device The device class, e.g. vex::motor, or a stub of it off the robot.
+ */
+template <typename Device>
+class DeviceSlot
+{
+public:
+    /**
+     * @brief Constructs a device from `args` and makes it the current one. One writer at a time.
+     *
+     * @return The new device.
+     */
+    template <typename... Args>
+    Device &emplace(Args &&...args)
+    {
+        const std::size_t spare = activeIndex == 0 ? 1 : 0;
+        buffers[spare].emplace(std::forward<Args>(args)...);
+        activeIndex = spare;
+        current.store(&*buffers[spare], std::memory_order_release);
+        return *buffers[spare];
+    }
+
+    /// @brief The current device, or nullptr before the first emplace().
+    Device *get() const { return current.load(std::memory_order_acquire); }
+
+private:
+    std::array<std::optional<Device>, 2> buffers;
+    std::size_t activeIndex = 1; // So the first emplace() fills buffer 0
+    std::atomic<Device *> current{nullptr};
+};
+
+#endif /* DEVICE_SLOT_H */
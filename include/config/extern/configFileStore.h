@@ -0,0 +1,53 @@
+#ifndef CONFIG_FILE_STORE_H
+#define CONFIG_FILE_STORE_H
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class ConfigFileStore
+ * @brief Writes settings changed at runtime back into the config file.
+ *
+ * set() only stages a value. Once no value has been staged for debounceMs, flush() applies all
+ * staged values in one rewrite: each key's top-level line is updated where it stands, so the
+ * file keeps its size and layout instead of growing with every change. The new text goes to a
+ * temporary file that then replaces the config file, so a power cut leaves either the old or the
+ * new file, never half of one.
+ */
+class ConfigFileStore
+{
+public:
+    /// @brief Quiet time after the last set() before a flush, so a burst of changes is one write.
+    static constexpr std::uint32_t debounceMs = 2000;
+
+    /**
+     * @struct Edit
+     * @brief A staged top-level value.
+     */
+    struct Edit
+    {
+        std::string key; ///< Upper case, as in the config schema.
+        std::string value;
+    };
+
+    explicit ConfigFileStore(std::string_view fileName);
+
+    void set(std::string_view key, std::string_view value, std::uint32_t nowMs);
+    bool isDue(std::uint32_t nowMs);
+    bool flush(std::string &writtenText);
+    void recover();
+
+    static std::string applyEdits(std::string_view text, std::span<const Edit> edits);
+
+private:
+    std::string fileName;
+    std::string tempFileName;
+    vex::mutex stagedMutex; ///< set() runs on the menu thread, flush() on the config watcher.
+    std::vector<Edit> staged;
+    std::uint32_t lastSetMs = 0;
+};
+
+#endif // CONFIG_FILE_STORE_H
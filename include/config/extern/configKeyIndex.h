@@ -0,0 +1,99 @@
+#ifndef CONFIG_KEY_INDEX_H
+#define CONFIG_KEY_INDEX_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// Keys are matched without regard to case, so "ConfigType", "CONFIGTYPE" and "configtype" are one key.
+constexpr char upperAscii(char ch)
+{
+    return (ch >= 'a' && ch <= 'z') ? static_cast<char>(ch - 'a' + 'A') : ch;
+}
+
+constexpr std::uint32_t configKeyHash(std::string_view key, std::uint32_t seed)
+{
+    std::uint32_t hash = 2166136261u ^ seed; // FNV-1a
+    for (char ch : key)
+    {
+        hash ^= static_cast<std::uint8_t>(upperAscii(ch));
+        hash *= 16777619u;
+    }
+    return hash ^ (hash >> 15);
+}
+
+constexpr bool configKeyEquals(std::string_view a, std::string_view b)
+{
+    if (a.size() != b.size())
+    {
+        return false;
+    }
+    for (std::size_t i = 0; i < a.size(); ++i)
+    {
+        if (upperAscii(a[i]) != upperAscii(b[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @struct ConfigKeyIndex
+ * @brief Collision-free hash table from key to table row, built at compile time.
+ *
+ * Slot `configKeyHash(key, seed) % Slots` holds the row index plus one (0 is empty). A lookup is
+ * one hash and one key comparison to reject unknown keys.
+ */
+template <std::size_t Slots>
+struct ConfigKeyIndex
+{
+    std::uint32_t seed = 0;
+    std::array<std::uint8_t, Slots> slots{};
+    bool found = false;
+};
+
+/**
+ * @brief Searches for a seed under which every `rows[i].*key` lands in its own slot.
+ *
+ * Check `found` with a static_assert; a table that collides needs more slots.
+ */
+template <std::size_t Slots, typename Row, std::size_t N>
+constexpr ConfigKeyIndex<Slots> buildConfigKeyIndex(const std::array<Row, N> &rows, std::string_view Row::*key)
+{
+    static_assert(N < 255, "Slot entries are one byte");
+    ConfigKeyIndex<Slots> index;
+    for (std::uint32_t seed = 0; seed < 4096 && !index.found; ++seed)
+    {
+        index.seed = seed;
+        index.slots = {};
+        index.found = true;
+        for (std::size_t i = 0; i < N && index.found; ++i)
+        {
+            std::uint8_t &slot = index.slots[configKeyHash(rows[i].*key, seed) % Slots];
+            index.found = slot == 0;
+            slot = static_cast<std::uint8_t>(i + 1);
+        }
+    }
+    return index;
+}
+
+/**
+ * @brief Finds the row whose key is `name`, ignoring case, in O(1).
+ *
+ * @return The row, or nullptr if no row has that key.
+ */
+template <std::size_t Slots, typename Row, std::size_t N>
+constexpr const Row *findConfigKey(const ConfigKeyIndex<Slots> &index, const std::array<Row, N> &rows, std::string_view Row::*key, std::string_view name)
+{
+    const std::uint8_t slot = index.slots[configKeyHash(name, index.seed) % Slots];
+    if (slot == 0)
+    {
+        return nullptr;
+    }
+    const Row &row = rows[slot - 1];
+    return configKeyEquals(row.*key, name) ? &row : nullptr;
+}
+
+#endif // CONFIG_KEY_INDEX_H
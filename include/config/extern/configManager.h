@@ -1,4 +1,7 @@
-#include <map>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <span>
 #include <string>
 
 /**
@@ -38,15 +41,23 @@ std::array<ControllerButtonInfo, 12> getControllerButtonArray(const vex::control
 class configManager
 {
 public:
+    /// @brief Tag for a configManager that only parses: no maintenance journal or other SD access.
+    struct ParseOnly
+    {
+    };
+
     configManager(const std::string &configFileName, const std::string &maintenanceFileName);
+    configManager(const std::string &configFileName, ParseOnly);
     void resetOrInitializeConfig(std::string_view message);
     bool stringToBool(std::string_view str);
     template <typename T>
     T stringToNumber(std::string_view str);
-    void setValuesFromConfig();
+    bool setValuesFromConfig(std::string_view text);
     bool validateStringNotEmpty(const std::string &value);
     void parseConfig();
-    void parseComplexConfig(std::ifstream &configFile, const std::string &section);
+    void startWatching(std::uint32_t periodMs = 1000);
+    bool reloadConfig();
+    bool writeBackSettings(std::uint32_t nowMs);
 
     enum class DriveMode
     {
@@ -62,6 +73,97 @@ public:
         Controller
     };
 
+    /**
+     * @enum DriveOutput
+     * @brief How driver commands reach the drive motors.
+     */
+    enum class DriveOutput
+    {
+        Voltage, ///< Stick position maps directly to motor voltage.
+        Velocity ///< Stick position is a velocity target tracked by a closed loop.
+    };
+
+    /**
+     * @enum AutonMode
+     * @brief What autonomous() runs.
+     */
+    enum class AutonMode
+    {
+        Route, ///< Follow the precomputed trajectory.
+        Replay ///< Replay a recorded driver run.
+    };
+
+    /**
+     * @enum DrivePriority
+     * @brief Which part of the drive command keeps its share of the current budget first.
+     */
+    enum class DrivePriority
+    {
+        Turn,   ///< Keep steering authority while pushing.
+        Forward ///< Keep pushing force, give up turning first.
+    };
+
+    /**
+     * @struct VelocityGains
+     * @brief Drive velocity loop gains. Velocities are in rpm, outputs in volts.
+     */
+    struct VelocityGains
+    {
+        double kS = 0.3;   ///< Static friction voltage.
+        double kV = 0.02;  ///< Volts per rpm.
+        double kA = 0.002; ///< Volts per rpm/s.
+        double kP = 0.04;  ///< Volts per rpm of error.
+        double kI = 0.02;  ///< Volts per rpm*s of accumulated error.
+    };
+
+    /**
+     * @enum Device
+     * @brief Every device the config file places, in the order the default file lists them.
+     */
+    enum class Device : std::uint8_t
+    {
+        FrontLeftMotor,
+        FrontRightMotor,
+        RearLeftMotor,
+        RearRightMotor,
+        Inertial,
+        RearBumper,
+        Count
+    };
+
+    /**
+     * @struct DeviceConfig
+     * @brief Where one device is plugged in, resolved from its name when the config is parsed.
+     */
+    struct DeviceConfig
+    {
+        int port = 0; ///< Smart port as labelled on the brain (1-21), or three-wire port 0-7 for A-H.
+        vex::gearSetting gearSetting = vex::gearSetting::ratio18_1;
+        bool reversed = false;
+    };
+    using DeviceTable = std::array<DeviceConfig, static_cast<std::size_t>(Device::Count)>;
+
+    /**
+     * @struct LiveSettings
+     * @brief The settings that may change while the robot runs, published together by the config
+     *        watcher. Readers copy them out of a SeqLock, so they never lock and never see half
+     *        of a reload.
+     */
+    struct LiveSettings
+    {
+        std::uint32_t revision = 0; ///< Increases with every publish.
+        std::size_t ctrlr1PollingRate = 25;
+        int leftDeadzone = 10;
+        int rightDeadzone = 10;
+        double inputExpo = 0;
+        double slewRate = 0;
+        VelocityGains velocityGains;
+        bool menuStopsDrive = true;
+        double driveCurrentBudget = 8;
+        DrivePriority drivePriority = DrivePriority::Turn;
+        DeviceTable devices{}; ///< Where every device is plugged in; a reload only moves drive motor ports.
+    };
+
     ConfigType configType;
     DriveMode driveMode;
 
@@ -69,7 +171,7 @@ public:
     bool getLogToFile() const { return logToFile; }
     std::size_t getPollingRate() const { return POLLINGRATE; }
     bool getPrintLogo() const { return PRINTLOGO; }
-    std::size_t getCtrlr1PollingRate() const { return CTRLR1POLLINGRATE; }
+    std::size_t getCtrlr1PollingRate() const { return live.read().ctrlr1PollingRate; }
     Log::Level getLogLevel() const { return logLevel; }
     std::string getTeamNumber() const { return teamNumber; };
     int getOdometer() const { return odometer; }
@@ -92,33 +194,78 @@ public:
     void setDriveMode(const DriveMode &mode);
     void SetVsyncGif(const bool &value);
 
-    std::string getGearRatio(const std::string &motorName) const;
-    bool getMotorReversed(const std::string &motorName) const;
-    vex::gearSetting getGearSetting(const std::string &ratio) const;
-    int getMotorPort(const std::string &motorName);
-    vex::triport::port *getTriPort(const std::string &portName);
+    static std::span<const ConfigField> getSchema();
+    static std::string_view deviceName(Device device);
+    DeviceConfig getDeviceConfig(Device device) const { return live.read().devices[static_cast<std::size_t>(device)]; }
+    vex::triport::port *getTriPort(Device device) const;
+    static void writeDeviceConfig(std::ostream &out, const DeviceTable &table);
+
+    /// @brief The PORT, GEAR_RATIO and REVERSED fields of a device block; DeviceBlock holds their text in this order.
+    enum class DeviceFieldKey : std::uint8_t
+    {
+        Port,
+        GearRatio,
+        Reversed,
+        Count
+    };
+    using DeviceBlock = std::array<std::string_view, static_cast<std::size_t>(DeviceFieldKey::Count)>;
+    static bool findDeviceField(std::string_view name, DeviceFieldKey &key);
 
     void updateOdometer(const int &averagePosition);
     void checkServiceInterval();
+    void startMaintenanceJournal(std::uint32_t periodMs = 30000);
 
     ConfigType stringToConfigType(const std::string &str);
     Log::Level stringToLogLevel(const std::string &str);
 
-    int getLeftDeadzone() const { return leftDeadzone; }
+    // Live settings: getters read the last published LiveSettings, setters stage a value for the
+    // next publish (at the end of parseConfig() or on a reload).
+    std::uint32_t getLiveRevision() const { return live.read().revision; }
+
+    int getLeftDeadzone() const { return live.read().leftDeadzone; }
     void setLeftDeadzone(int value) { leftDeadzone = value; }
 
-    int getRightDeadzone() const { return rightDeadzone; }
+    int getRightDeadzone() const { return live.read().rightDeadzone; }
     void setRightDeadzone(int value) { rightDeadzone = value; }
 
+    double getInputExpo() const { return live.read().inputExpo; }
+    void setInputExpo(double value);
+
+    double getSlewRate() const { return live.read().slewRate; }
+    void setSlewRate(double value);
+
+    DriveOutput getDriveOutput() const { return driveOutput; }
+    void setDriveOutput(DriveOutput value) { driveOutput = value; }
+
+    VelocityGains getVelocityGains() const { return live.read().velocityGains; }
+
+    AutonMode getAutonMode() const { return autonMode; }
+    void setAutonMode(AutonMode value) { autonMode = value; }
+
+    bool getRecordInput() const { return recordInput; }
+    void setRecordInput(bool value) { recordInput = value; }
+
+    int getAebDistancePort() const { return aebDistancePort; }
+    void setAebDistancePort(int value);
+
+    bool getMenuStopsDrive() const { return live.read().menuStopsDrive; }
+    void setMenuStopsDrive(bool value) { menuStopsDrive = value; }
+
+    bool getPreflightPulse() const { return preflightPulse; }
+    void setPreflightPulse(bool value) { preflightPulse = value; }
+
+    double getDriveCurrentBudget() const { return live.read().driveCurrentBudget; }
+    void setDriveCurrentBudget(double value);
+
+    DrivePriority getDrivePriority() const { return live.read().drivePriority; }
+    void setDrivePriority(DrivePriority value) { drivePriority = value; }
+
 private:
-    std::map<std::string, int> motorPorts;
-    std::map<std::string, std::string> motorGearRatios;
-    std::map<std::string, bool> motorReversed;
-    std::map<std::string, vex::triport::port *> triPorts;
-    std::map<std::string, int> inertialPorts;
+    DeviceTable devices; ///< Staged by the parser, published with the live settings.
 
     std::string configFileName;
     std::string maintenanceFileName;
+    ConfigFileStore configStore; ///< Settings changed at runtime, written back by the config watcher.
     std::size_t maxOptionSize;
     bool logToFile;
     std::size_t POLLINGRATE;
@@ -133,12 +280,75 @@ private:
     std::string driverGifPath;
     std::string customMessage;
 
+    MaintenanceJournal maintenanceJournal;
     int odometer;
     int lastService;
     int serviceInterval;
     bool serviceWarningLogged;
+    int lastDrivePosition = 0; ///< Motor position at the last updateOdometer(), in degrees.
+    std::atomic<bool> odometerRebaseline{false}; ///< Set when a drive motor moved; its encoder starts from its own zero.
     int leftDeadzone;
     int rightDeadzone;
+    double inputExpo;
+    double slewRate;
+    DriveOutput driveOutput;
+    VelocityGains velocityGains;
+    AutonMode autonMode;
+    bool recordInput;
+    int aebDistancePort;
+    bool menuStopsDrive;
+    bool preflightPulse;
+    double driveCurrentBudget;
+    DrivePriority drivePriority;
+
+    /**
+     * @struct ParseLocation
+     * @brief Position in the config file while it is parsed, for error messages. Line 0 outside a parse.
+     */
+    struct ParseLocation
+    {
+        std::size_t line = 0;
+        std::size_t column = 0;
+    };
+    ParseLocation parseLocation;
+    std::size_t parseErrors = 0;
+
+    std::string locationSuffix() const;
+
+    /// @brief Every top-level key with its type, default, range and setter; see configSchema.cpp.
+    struct Schema;
+    static const ConfigField *findConfigField(std::string_view key);
+    static std::string_view configChoiceName(std::string_view key, int value);
+    bool parseConfigValue(const ConfigField &field, std::string_view text, ConfigValue &value);
+    bool applyConfigValue(std::string_view key, std::string_view text);
+    static void writeDefaultConfig(std::ostream &out);
+    void applyDefaults();
+    void applyDeviceConfig(std::string_view section, std::string_view name, const DeviceBlock &block);
+
+    bool readConfigFile(std::string &buffer) const;
+    static std::uint64_t configTextHash(std::string_view text);
+    bool loadSnapshot(std::uint64_t textHash);
+    void saveSnapshot(std::uint64_t textHash) const;
+
+    /// Written by one thread at a time: the main thread until startWatching(), then the watcher.
+    SeqLock<LiveSettings> live;
+    std::uint64_t loadedTextHash = 0;
+    bool interactive = true; ///< false while the watcher parses in the background: never prompt.
+    bool watching = false;
+    std::uint32_t watchPeriodMs = 1000;
+
+    void publishLiveSettings(const configManager &source);
+    void rebindMovedMotors(DeviceTable &next);
+    static int watchTask(void *arg);
+
+    // Values queued by writeMaintenanceData() for the journal thread, which alone touches the SD card.
+    vex::mutex maintenanceMutex;
+    MaintenanceJournal::State pendingMaintenance;
+    bool maintenanceDirty = false;
+    bool journaling = false;
+    std::uint32_t journalPeriodMs = 30000;
+
+    static int maintenanceTask(void *arg);
 
     void readMaintenanceData();
     void writeMaintenanceData();
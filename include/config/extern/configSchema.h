@@ -0,0 +1,66 @@
+#ifndef CONFIG_SCHEMA_H
+#define CONFIG_SCHEMA_H
+
+#include <cstdint>
+#include <iosfwd>
+#include <span>
+#include <string_view>
+
+class configManager;
+
+/**
+ * @enum ConfigValueType
+ * @brief How a top-level config value is written in the file.
+ */
+enum class ConfigValueType : std::uint8_t
+{
+    Bool,    ///< "true"/"false" or "1"/"0".
+    Integer, ///< Whole number within [min, max].
+    Number,  ///< Decimal number within [min, max].
+    Text,    ///< Non-empty text of at most `max` characters.
+    Choice,  ///< One of the field's named choices.
+    Version  ///< Written as the firmware version; a mismatch is only warned about.
+};
+
+/**
+ * @struct ConfigChoice
+ * @brief One accepted spelling of an enumerated value. The first name listed for a value is the one written.
+ */
+struct ConfigChoice
+{
+    std::string_view name;
+    int value;
+};
+
+/**
+ * @struct ConfigValue
+ * @brief A parsed value; only the member matching the field's type is set.
+ */
+struct ConfigValue
+{
+    bool flag = false;
+    long long integer = 0;
+    double number = 0;
+    std::string_view text;
+    int choice = 0;
+};
+
+/**
+ * @struct ConfigField
+ * @brief One row of the config schema: everything the parser, the default file writer, the
+ *        no-SD-card defaults and the config snapshot need to know about a top-level key.
+ */
+struct ConfigField
+{
+    std::string_view key;          ///< Upper case; keys in the file are matched case-insensitively.
+    ConfigValueType type;          ///< How the value is parsed.
+    std::string_view defaultValue; ///< Written to a new config file and applied when there is none.
+    double min;                    ///< Lowest Integer/Number value.
+    double max;                    ///< Highest Integer/Number value, or longest Text.
+    std::span<const ConfigChoice> choices;
+    void (*apply)(configManager &, const ConfigValue &);
+    void (*read)(const configManager &, ConfigValue &); ///< The current value, as apply() takes it. None for Version.
+    bool alias; ///< An older spelling of another key: read, but never written or defaulted.
+};
+
+#endif // CONFIG_SCHEMA_H
@@ -0,0 +1,53 @@
+#ifndef MAINTENANCE_JOURNAL_H
+#define MAINTENANCE_JOURNAL_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/**
+ * @class MaintenanceJournal
+ * @brief Append-only store for the odometer and service values that survives power loss.
+ *
+ * Every write appends one fixed-size record holding the whole state, a sequence number and a
+ * CRC, so a write cut off by power loss only damages that record and recovery takes the newest
+ * record that checks out. The journal alternates between two files: when the active file is
+ * full, or on the first write after a boot, the state is written to the start of the other file
+ * (truncating it) and appends continue there. The file holding the newest valid record is never
+ * truncated, so a failed compaction still leaves the previous state readable.
+ */
+class MaintenanceJournal
+{
+public:
+    /**
+     * @struct State
+     * @brief The values the journal stores.
+     */
+    struct State
+    {
+        std::int32_t odometer = 0;
+        std::int32_t lastService = 0;
+        std::int32_t serviceInterval = 1000;
+
+        bool operator==(const State &) const = default;
+    };
+
+    /// @brief Records appended to one file before the journal compacts into the other.
+    static constexpr std::uint32_t recordsPerFile = 64;
+
+    MaintenanceJournal(std::string_view firstFileName, std::string_view secondFileName);
+
+    bool recover(State &state);
+    bool append(const State &state);
+
+    std::uint32_t getSequence() const { return sequence; }
+
+private:
+    std::string fileNames[2];
+    std::size_t activeFile = 1;    ///< So a journal with no records starts in the first file
+    std::uint32_t activeRecords = 0;
+    std::uint32_t sequence = 0;    ///< Sequence number of the newest record written or recovered.
+    bool compactNext = true;       ///< A recovered file may end in a torn record: never append to it.
+};
+
+#endif // MAINTENANCE_JOURNAL_H
@@ -0,0 +1,312 @@
+#ifndef PREFLIGHT_CHECK_H
+#define PREFLIGHT_CHECK_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <format>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class PreflightCheck
+ * @brief Checks every added device at once, within a fixed time budget, before the robot is used.
+ *
+ * The IMU must be installed, done calibrating and hold a steady rotation reading while the
+ * robot stands still, so it is watched first, before anything moves. Motors must be installed
+ * and below the overheat temperature. Unless pulses are disabled, they then get a short
+ * low-voltage pulse forward and the same pulse back, so the robot ends where it started, and
+ * must turn their encoders the commanded way without drawing the current of a jammed gearbox.
+ * All motors are pulsed and sampled in the same loop, so the check takes the same time for one
+ * motor or eight. Devices not judged when the budget runs out fail.
+ *
+ * Nothing here depends on the V5 SDK; preflight.cpp adapts vex::motor and vex::inertial.
+ *
+ * @tparam Motor A small handle, copied into the check, with installed(), temperatureC(),
+ *               positionDeg(), currentAmps(), spinVolts(double) and coast().
+ * @tparam Imu A handle with installed(), isCalibrating() and rotationDeg().
+ * @tparam Clock Anything with now() and sleepUntil(deadline) in microseconds, e.g.
+ *               PeriodicScheduler::Clock.
+ */
+template <typename Motor, typename Imu, typename Clock>
+class PreflightCheck
+{
+public:
+    /**
+     * @struct Limits
+     * @brief Pass thresholds and timing.
+     */
+    struct Limits
+    {
+        double maxTemperatureC = 55;     ///< motorMonitor's overheat warning.
+        bool pulseMotors = true;         ///< false: only the installed and temperature checks.
+        double pulseVolts = 2;           ///< Enough to turn a free drivetrain slowly.
+        std::uint32_t pulseMs = 120;     ///< Length of each of the two pulses.
+        double minTravelDeg = 5;         ///< Encoder travel expected from the forward pulse.
+        double maxPulseAmps = 1.5;       ///< More than this at pulseVolts means something binds.
+        double maxImuDriftDeg = 1;       ///< Allowed spread of the IMU rotation while it is watched.
+        std::uint32_t imuWatchMs = 100;  ///< How long the IMU is watched, before any motor moves.
+        std::uint32_t sampleMs = 10;     ///< How often currents and the IMU are read.
+        std::uint32_t budgetMs = 500;    ///< Hard limit for the whole check.
+    };
+
+    /**
+     * @struct Result
+     * @brief Verdict for one device. `reason` says why it failed and is empty if it passed.
+     */
+    struct Result
+    {
+        std::string name;
+        bool passed = false;
+        std::string reason;
+    };
+
+    explicit PreflightCheck(const Clock &clock, const Limits &limits = Limits{})
+        : clock(clock), limits(limits) {}
+
+    void addMotor(std::string_view name, Motor motor) { motors.push_back(MotorProbe{motor, Result{std::string(name), false, {}}}); }
+    void addImu(std::string_view name, Imu imu) { imus.push_back(ImuProbe{imu, Result{std::string(name), false, {}}}); }
+
+    /**
+     * @brief Runs every check and returns whether all devices passed. Blocks for at most the budget.
+     */
+    bool run()
+    {
+        const std::uint64_t startUs = clock.now();
+        const std::uint64_t deadlineUs = startUs + std::uint64_t{limits.budgetMs} * 1000;
+
+        for (ImuProbe &probe : imus)
+        {
+            if (!probe.imu.installed())
+            {
+                fail(probe.result, "not installed");
+                continue;
+            }
+            if (probe.imu.isCalibrating())
+            {
+                fail(probe.result, "still calibrating");
+                continue;
+            }
+            probe.active = true;
+            probe.minDeg = std::numeric_limits<double>::infinity();
+            probe.maxDeg = -std::numeric_limits<double>::infinity();
+        }
+        for (MotorProbe &probe : motors)
+        {
+            if (!probe.motor.installed())
+            {
+                fail(probe.result, "not installed");
+                continue;
+            }
+            const double temperature = probe.motor.temperatureC();
+            if (temperature >= limits.maxTemperatureC)
+            {
+                fail(probe.result, std::format("{:.0f}C", temperature));
+                continue;
+            }
+            probe.active = true;
+        }
+
+        // The IMU alone while the robot stands still, so a pulse that turns it is not drift.
+        const std::uint64_t imuEndUs = startUs + std::uint64_t{limits.imuWatchMs} * 1000;
+        std::uint64_t nowUs = clock.now();
+        while (nowUs < imuEndUs && nowUs < deadlineUs)
+        {
+            sampleImus();
+            clock.sleepUntil(std::min({nowUs + std::uint64_t{limits.sampleMs} * 1000, imuEndUs, deadlineUs}));
+            nowUs = clock.now();
+        }
+        const bool imuFinished = nowUs >= imuEndUs;
+        sampleImus();
+
+        // Forward pulse, then reverse pulse.
+        bool pulsesFinished = !limits.pulseMotors;
+        if (limits.pulseMotors && imuFinished)
+        {
+            for (MotorProbe &probe : motors)
+            {
+                probe.startDeg = probe.active ? probe.motor.positionDeg() : 0;
+            }
+            const std::uint64_t forwardEndUs = nowUs + std::uint64_t{limits.pulseMs} * 1000;
+            const std::uint64_t reverseEndUs = forwardEndUs + std::uint64_t{limits.pulseMs} * 1000;
+            spinActive(limits.pulseVolts);
+            bool reversed = false;
+            while (nowUs < reverseEndUs && nowUs < deadlineUs)
+            {
+                sampleMotors();
+                if (!reversed && nowUs >= forwardEndUs)
+                {
+                    for (MotorProbe &probe : motors)
+                    {
+                        probe.travelDeg = probe.active ? probe.motor.positionDeg() - probe.startDeg : 0;
+                    }
+                    spinActive(-limits.pulseVolts);
+                    reversed = true;
+                }
+                clock.sleepUntil(std::min(nowUs + std::uint64_t{limits.sampleMs} * 1000, deadlineUs));
+                nowUs = clock.now();
+            }
+            for (MotorProbe &probe : motors)
+            {
+                if (probe.active)
+                {
+                    probe.motor.coast();
+                }
+            }
+            pulsesFinished = reversed && nowUs >= reverseEndUs;
+        }
+
+        for (MotorProbe &probe : motors)
+        {
+            if (probe.active)
+            {
+                judgeMotor(probe, pulsesFinished);
+            }
+        }
+        for (ImuProbe &probe : imus)
+        {
+            if (probe.active)
+            {
+                judgeImu(probe, imuFinished);
+            }
+        }
+        elapsedUs = clock.now() - startUs;
+
+        results.clear();
+        for (const MotorProbe &probe : motors)
+        {
+            results.push_back(probe.result);
+        }
+        for (const ImuProbe &probe : imus)
+        {
+            results.push_back(probe.result);
+        }
+        return std::all_of(results.begin(), results.end(), [](const Result &result)
+                           { return result.passed; });
+    }
+
+    const std::vector<Result> &getResults() const { return results; }
+    std::uint64_t getElapsedUs() const { return elapsedUs; }
+
+private:
+    struct MotorProbe
+    {
+        Motor motor;
+        Result result;
+        bool active = false;
+        double startDeg = 0;
+        double travelDeg = 0;
+        double peakAmps = 0;
+    };
+
+    struct ImuProbe
+    {
+        Imu imu;
+        Result result;
+        bool active = false;
+        bool finite = true;
+        double minDeg = 0;
+        double maxDeg = 0;
+    };
+
+    static void fail(Result &result, std::string reason)
+    {
+        result.passed = false;
+        result.reason = std::move(reason);
+    }
+
+    void spinActive(double volts)
+    {
+        for (MotorProbe &probe : motors)
+        {
+            if (probe.active)
+            {
+                probe.motor.spinVolts(volts);
+            }
+        }
+    }
+
+    void sampleMotors()
+    {
+        for (MotorProbe &probe : motors)
+        {
+            if (probe.active)
+            {
+                probe.peakAmps = std::max(probe.peakAmps, std::abs(probe.motor.currentAmps()));
+            }
+        }
+    }
+
+    void sampleImus()
+    {
+        for (ImuProbe &probe : imus)
+        {
+            if (probe.active)
+            {
+                const double rotation = probe.imu.rotationDeg();
+                probe.finite = probe.finite && std::isfinite(rotation);
+                probe.minDeg = std::min(probe.minDeg, rotation);
+                probe.maxDeg = std::max(probe.maxDeg, rotation);
+            }
+        }
+    }
+
+    void judgeMotor(MotorProbe &probe, bool finished)
+    {
+        if (!limits.pulseMotors)
+        {
+            probe.result.passed = true;
+        }
+        else if (!finished)
+        {
+            fail(probe.result, "timed out");
+        }
+        else if (probe.peakAmps > limits.maxPulseAmps)
+        {
+            fail(probe.result, std::format("{:.1f}A at {:.0f}V", probe.peakAmps, limits.pulseVolts));
+        }
+        else if (probe.travelDeg <= -limits.minTravelDeg)
+        {
+            fail(probe.result, "turns backwards");
+        }
+        else if (probe.travelDeg < limits.minTravelDeg)
+        {
+            fail(probe.result, "no encoder response");
+        }
+        else
+        {
+            probe.result.passed = true;
+        }
+    }
+
+    void judgeImu(ImuProbe &probe, bool finished)
+    {
+        if (!finished)
+        {
+            fail(probe.result, "timed out");
+        }
+        else if (!probe.finite || probe.minDeg > probe.maxDeg)
+        {
+            fail(probe.result, "no reading");
+        }
+        else if (probe.maxDeg - probe.minDeg > limits.maxImuDriftDeg)
+        {
+            fail(probe.result, std::format("drifts {:.1f} deg", probe.maxDeg - probe.minDeg));
+        }
+        else
+        {
+            probe.result.passed = true;
+        }
+    }
+
+    Clock clock;
+    Limits limits;
+    std::vector<MotorProbe> motors;
+    std::vector<ImuProbe> imus;
+    std::vector<Result> results;
+    std::uint64_t elapsedUs = 0;
+};
+
+#endif // PREFLIGHT_CHECK_H
@@ -1,22 +1,15 @@
 extern vex::brain Brain;
 
-extern vex::motor frontLeftMotor;
-extern vex::motor frontRightMotor;
-
-extern vex::motor rearLeftMotor;
-extern vex::motor rearRightMotor;
-
-extern vex::motor_group LeftDriveSmart;
-extern vex::motor_group RightDriveSmart;
-
-extern vex::smartdrive Drivetrain;
+// Drivetrain geometry shared by the drive controllers.
+constexpr double wheelTravelMm = 319.19;
+constexpr double trackWidthMm = 320;
+constexpr double wheelBaseMm = 165;
+constexpr vex::axisType imuForwardAxis = vex::axisType::xaxis;
 
 extern vex::controller primaryController;
 extern vex::controller partnerController;
 
-extern vex::inertial InertialGyro;
-
-extern vex::bumper RearBumper;
+vex::distance *getFrontDistanceSensor();
 
 extern vex::competition Competition;
 
@@ -0,0 +1,57 @@
+#ifndef ANTI_LOCK_BRAKING_H
+#define ANTI_LOCK_BRAKING_H
+
+#include <array>
+
+/**
+ * @class AntiLockBraking
+ * @brief Limits each wheel's braking voltage so the wheel keeps turning while the driver brakes.
+ *
+ * A wheel is braking when its command pushes against the way the ground moves under it. Its
+ * slip is how much slower than the ground it turns: 0 rolling, 1 locked, more when reverse
+ * voltage spins it backwards. The motor's braking effort is how far its command sits below
+ * the voltage that would keep the wheel rolling with the ground, so that difference plays the
+ * part of brake pressure: above the target slip it is cut at once and then reapplied
+ * gradually, like a car's ABS, so the tyre stays near its best grip instead of sliding.
+ * Wheels that are driven with the motion are not touched.
+ */
+class AntiLockBraking
+{
+public:
+    struct Settings
+    {
+        double targetSlip = 0.2;        ///< Slip allowed before the braking effort is cut.
+        double slipGain = 4.0;          ///< Braking reduction per unit of slip above target.
+        double minScale = 0.0;          ///< Lowest fraction of the braking effort that is kept.
+        double reapplyPerSecond = 4.0;  ///< How fast a cut wheel returns to the full braking effort.
+        double minSpeed = 0.1;          ///< m/s of ground speed below which braking is not limited.
+        double freeRpm = 200;           ///< Wheel speed at 12 V with no load.
+        ChassisSpeedEstimator::Settings estimator;
+    };
+
+    struct Inputs
+    {
+        std::array<double, WheelCount> wheelRpm{}; ///< Measured wheel velocities, Wheel order.
+        double forwardAccelG = 0;                  ///< IMU acceleration along the drive direction.
+        double yawRateDps = 0;                     ///< IMU yaw rate, positive turning right.
+        double dtSeconds = 0.025;
+    };
+
+    AntiLockBraking() = default;
+    explicit AntiLockBraking(const Settings &settings) : settings(settings), estimator(settings.estimator) {}
+
+    void apply(WheelVolts &command, const Inputs &inputs);
+    void reset();
+
+    double getChassisSpeed() const { return estimator.getSpeed(); }
+    double getSlip(Wheel wheel) const { return slip[static_cast<std::size_t>(wheel)]; }
+    double getScale(Wheel wheel) const { return scale[static_cast<std::size_t>(wheel)]; }
+
+private:
+    Settings settings;
+    ChassisSpeedEstimator estimator;
+    std::array<double, WheelCount> slip{};
+    std::array<double, WheelCount> scale{1, 1, 1, 1};
+};
+
+#endif /* ANTI_LOCK_BRAKING_H */
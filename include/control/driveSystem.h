@@ -0,0 +1,58 @@
+#ifndef DRIVE_SYSTEM_H
+#define DRIVE_SYSTEM_H
+
+// Drive system flags
+extern bool tractionControlEnabled;
+extern bool stabilityControlEnabled;
+extern bool absEnabled;
+extern bool aebEnabled;
+extern bool powerGovernorEnabled;
+
+/**
+ * @class DriveSystem
+ * @brief The driver-control drive pipeline: sticks in, motor commands out.
+ *
+ * Runs the input pipeline, stability control, optional closed-loop velocity output, ABS,
+ * traction control, the current governor and emergency braking, then commands the four drive motors through a MotorCommandBatch so
+ * each tick costs at most one write per motor. Both userControl and the input
+ * replayer feed it, so a replayed run goes through exactly the same path as the driver.
+ */
+class DriveSystem
+{
+public:
+    explicit DriveSystem(std::uint32_t tickMs);
+
+    void configure(configManager::DriveMode mode);
+    void reloadSettings(std::uint32_t tickMs);
+    configManager::DriveMode getDriveMode() const { return inputPipeline.getDriveMode(); }
+    double getTickSeconds() const { return tickSeconds; }
+
+    WheelVolts compute(const SensorFrame &frame);
+    /// @brief The input pipeline's command from the last compute(), before the wheel stages.
+    const DriveCommand &getInputCommand() const { return inputCommand; }
+    void tick(const SensorFrame &frame);
+    void stop();
+
+    std::uint32_t getDeviceWritesPerSecond() const { return wheelOutputs.getWritesPerSecond(); }
+    std::uint32_t getDeviceWrites() const { return wheelOutputs.getTotalWrites(); }
+    EmergencyBraking::State getBrakingState() const { return emergencyBraking.getState(); }
+    double getCurrentHeadroomAmps() const { return powerGovernor.getHeadroomAmps(); }
+
+private:
+    double tickSeconds;
+    InputPipeline inputPipeline;
+    DriveCommand inputCommand;
+    TractionControl tractionControl;
+    AntiLockBraking antiLockBraking;
+    StabilityControl stabilityControl;
+    PowerGovernor powerGovernor;
+    EmergencyBraking emergencyBraking;
+    bool velocityOutput;
+    double maxDriveRpm;
+    VelocityController leftVelocityController;
+    VelocityController rightVelocityController;
+    MotorCommandBatch<vex::motor, WheelCount> wheelOutputs;
+    std::uint32_t motorGeneration; ///< Devices.getGeneration() the wheel outputs point at.
+};
+
+#endif /* DRIVE_SYSTEM_H */
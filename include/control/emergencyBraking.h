@@ -0,0 +1,79 @@
+#ifndef EMERGENCY_BRAKING_H
+#define EMERGENCY_BRAKING_H
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @class EmergencyBraking
+ * @brief Automatic emergency braking, run as the last stage of every drive tick.
+ *
+ * Time to impact is the distance to the obstacle ahead divided by the closing speed. It
+ * escalates the state through Warn (2 s), Limit (1.5 s, forward voltage capped) and
+ * Brake (1 s, forward motion held). An IMU collision event or a deceleration spike while
+ * driving forward jumps straight to Brake. A state is kept for at least minHoldSeconds.
+ * It then drops one level at a time, and only once time to impact clears its threshold
+ * plus the hysteresis margin. So a noisy distance reading cannot make the drive chatter.
+ * While the robot is stopped with the obstacle still in view, the state is held.
+ *
+ * The stage only rewrites the wheel voltages it is given. The preemption is therefore
+ * bounded to one tick and does not depend on any device call.
+ */
+class EmergencyBraking
+{
+public:
+    enum class State : std::uint8_t
+    {
+        Clear,
+        Warn,
+        Limit,
+        Brake
+    };
+
+    struct Settings
+    {
+        double warnSeconds = 2.0;        ///< Time to impact that starts the warning.
+        double limitSeconds = 1.5;       ///< Time to impact that caps forward voltage.
+        double brakeSeconds = 1.0;       ///< Time to impact that holds the drive.
+        double hysteresisSeconds = 0.3;  ///< Extra time to impact needed before stepping down.
+        double minHoldSeconds = 0.5;     ///< Shortest time any escalated state is kept.
+        double limitVolts = 4;           ///< Forward voltage allowed in Limit.
+        double impactDecelG = 1.5;       ///< Forward deceleration read as hitting something.
+        double minClosingSpeed = 0.05;   ///< m/s below which nothing is approaching.
+    };
+
+    struct Inputs
+    {
+        double forwardSpeed = 0;       ///< Chassis speed in m/s, positive forward.
+        double obstacleDistance = -1;  ///< Metres to the obstacle ahead, negative when none is seen.
+        double forwardAccelG = 0;      ///< IMU acceleration along the drive direction.
+        bool collision = false;        ///< InertialGyro reported a collision since the last tick.
+        bool rearContact = false;      ///< RearBumper is pressed.
+        double dtSeconds = 0.025;
+    };
+
+    EmergencyBraking() = default;
+    explicit EmergencyBraking(const Settings &settings) : settings(settings) {}
+
+    State apply(WheelVolts &wheelVolts, const Inputs &inputs);
+    void reset();
+
+    State getState() const { return state; }
+    double getTimeToImpact() const { return timeToImpact; }
+
+private:
+    Settings settings;
+    State state = State::Clear;
+    double secondsInState = 0;
+    double timeToImpact = -1;
+
+    State stateForTimeToImpact(double seconds, double margin) const;
+};
+
+/// @brief Flags an InertialGyro collision for the next drive tick. Safe to call from the callback.
+void reportCollision();
+bool takeCollision();
+
+const char *emergencyBrakingStateName(EmergencyBraking::State state);
+
+#endif /* EMERGENCY_BRAKING_H */
@@ -0,0 +1,218 @@
+#ifndef INPUT_PIPELINE_H
+#define INPUT_PIPELINE_H
+
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <tuple>
+
+/**
+ * @struct StickSample
+ * @brief Raw controller axis positions for one control tick (Axis1..Axis4, -100 to 100).
+ */
+struct StickSample
+{
+    std::array<int, 4> axes{};
+};
+
+StickSample readSticks(const vex::controller &controller);
+
+/**
+ * @struct DriveCommand
+ * @brief Output of the input pipeline, in volts.
+ */
+struct DriveCommand
+{
+    double forwardVolts = 0;
+    double turnVolts = 0;
+
+    double leftVolts() const { return forwardVolts + turnVolts; }
+    double rightVolts() const { return forwardVolts - turnVolts; }
+};
+
+/// @brief Zeroes stick positions whose magnitude is below the threshold (percent).
+struct Deadzone
+{
+    int threshold;
+    double operator()(double percent) const { return std::abs(percent) < threshold ? 0 : percent; }
+};
+
+/// @brief Blends a linear and cubic response. 0 is linear, 1 is fully cubic.
+struct ExpoCurve
+{
+    double expo;
+    double operator()(double percent) const
+    {
+        double x = percent / 100.0;
+        return 100.0 * ((1.0 - expo) * x + expo * x * x * x);
+    }
+};
+
+/// @brief Maps percent to volts.
+struct VoltageScale
+{
+    double maxVolts;
+    double operator()(double percent) const { return percent * maxVolts / 100.0; }
+};
+
+/**
+ * @brief Applies a list of stateless stages in order.
+ */
+template <typename... Stages>
+struct StageChain
+{
+    std::tuple<Stages...> stages;
+
+    double operator()(double value) const
+    {
+        std::apply([&value](const Stages &...stage)
+                   { ((value = stage(value)), ...); }, stages);
+        return value;
+    }
+};
+
+/**
+ * @class AxisCurveTable
+ * @brief Precomputed stick-to-volts table so a control tick is a single lookup.
+ *
+ * The controller reports whole percent positions, so 201 entries cover the full range.
+ */
+class AxisCurveTable
+{
+public:
+    template <typename Chain>
+    void build(const Chain &chain)
+    {
+        for (int position = -100; position <= 100; ++position)
+        {
+            table[position + 100] = chain(position);
+        }
+    }
+
+    double lookup(int position) const
+    {
+        position = position < -100 ? -100 : (position > 100 ? 100 : position);
+        return table[position + 100];
+    }
+
+private:
+    std::array<double, 201> table{};
+};
+
+/**
+ * @class SlewRateLimiter
+ * @brief Limits how fast an output may change per tick. A rate of 0 disables the limit.
+ */
+class SlewRateLimiter
+{
+public:
+    void setRate(double voltsPerSecond) { rate = voltsPerSecond; }
+    void reset(double value = 0) { last = value; }
+
+    double operator()(double target, double dtSeconds)
+    {
+        if (rate <= 0)
+        {
+            last = target;
+            return last;
+        }
+        double maxStep = rate * dtSeconds;
+        double step = target - last;
+        step = step > maxStep ? maxStep : (step < -maxStep ? -maxStep : step);
+        last += step;
+        return last;
+    }
+
+private:
+    double rate = 0;
+    double last = 0;
+};
+
+/**
+ * @brief Compile-time axis assignment for each drive mode.
+ *
+ * `primary` feeds forward (or the left side in tank) and uses the left deadzone,
+ * `secondary` feeds turn (or the right side in tank) and uses the right deadzone.
+ * Axis indices are zero based, so 0 is Axis1.
+ */
+template <configManager::DriveMode Mode>
+struct DriveModeAxes;
+
+template <>
+struct DriveModeAxes<configManager::DriveMode::LeftArcade>
+{
+    static constexpr int primary = 2;   // Axis3
+    static constexpr int secondary = 3; // Axis4
+    static constexpr bool tank = false;
+};
+
+template <>
+struct DriveModeAxes<configManager::DriveMode::RightArcade>
+{
+    static constexpr int primary = 1;   // Axis2
+    static constexpr int secondary = 0; // Axis1
+    static constexpr bool tank = false;
+};
+
+template <>
+struct DriveModeAxes<configManager::DriveMode::SplitArcade>
+{
+    static constexpr int primary = 2;   // Axis3
+    static constexpr int secondary = 0; // Axis1
+    static constexpr bool tank = false;
+};
+
+template <>
+struct DriveModeAxes<configManager::DriveMode::Tank>
+{
+    static constexpr int primary = 2;   // Axis3
+    static constexpr int secondary = 1; // Axis2
+    static constexpr bool tank = true;
+};
+
+/**
+ * @class InputPipeline
+ * @brief Turns controller sticks into drive voltages.
+ *
+ * Each axis goes through deadzone, expo curve and voltage scaling (baked into a lookup
+ * table), then a slew-rate limit. configure() selects the mode-specialized processing
+ * function once, so a tick does not branch on the drive mode. Reconfiguring keeps the slew
+ * limiters where they are, so the output ramps from its last value; reset() drops them to 0 V.
+ */
+class InputPipeline
+{
+public:
+    struct Settings
+    {
+        int leftDeadzone = 10;
+        int rightDeadzone = 10;
+        double expo = 0;
+        double slewVoltsPerSecond = 0;
+        double maxVolts = 12;
+    };
+
+    InputPipeline();
+
+    void configure(configManager::DriveMode mode, const Settings &settings);
+    void reset();
+    configManager::DriveMode getDriveMode() const { return mode; }
+
+    DriveCommand process(const StickSample &sample, double dtSeconds) { return processFunction(*this, sample, dtSeconds); }
+
+private:
+    using ProcessFunction = DriveCommand (*)(InputPipeline &, const StickSample &, double);
+
+    template <configManager::DriveMode Mode>
+    static DriveCommand processMode(InputPipeline &pipeline, const StickSample &sample, double dtSeconds);
+
+    configManager::DriveMode mode;
+    ProcessFunction processFunction;
+    AxisCurveTable primaryTable;
+    AxisCurveTable secondaryTable;
+    SlewRateLimiter primarySlew;
+    SlewRateLimiter secondarySlew;
+};
+
+InputPipeline::Settings inputSettingsFromConfig();
+
+#endif /* INPUT_PIPELINE_H */
@@ -0,0 +1,80 @@
+#ifndef INPUT_RECORDER_H
+#define INPUT_RECORDER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @struct ControllerSample
+ * @brief Controller state for one tick: axes plus a bitmask of the 12 buttons.
+ *
+ * Button bits follow ControllerButton (A is bit 0, R2 is bit 11).
+ */
+struct ControllerSample
+{
+    StickSample sticks;
+    std::uint16_t buttons = 0;
+};
+
+/**
+ * @class InputRecorder
+ * @brief Records controller samples into a compact replay file.
+ *
+ * File layout: a fixed header (magic, format version, tick period, starting drive mode,
+ * sample count) followed by one record per tick. Each record is a change mask byte and
+ * only the fields that changed since the previous tick: one signed byte per changed axis,
+ * two bytes for the button mask and one byte for a drive mode change. A tick where nothing
+ * moved costs one byte.
+ */
+class InputRecorder
+{
+public:
+    InputRecorder(std::uint32_t tickMs, configManager::DriveMode driveMode, std::size_t maxSamples = 6000);
+
+    bool record(const ControllerSample &sample, configManager::DriveMode driveMode);
+    bool save(const std::string &fileName) const;
+
+    std::size_t getSampleCount() const { return sampleCount; }
+
+private:
+    std::uint32_t tickMs;
+    configManager::DriveMode startMode;
+    configManager::DriveMode currentMode;
+    std::size_t maxSamples;
+    std::size_t sampleCount = 0;
+    ControllerSample previous;
+    std::vector<std::uint8_t> data;
+};
+
+/**
+ * @class InputReplayer
+ * @brief Reads a replay file back one tick at a time.
+ *
+ * Samples are consumed by tick index, not wall time, so the same file always produces the
+ * same sequence of drive inputs.
+ */
+class InputReplayer
+{
+public:
+    bool load(const std::string &fileName);
+    bool next(ControllerSample &sample, configManager::DriveMode &driveMode);
+
+    std::uint32_t getTickMs() const { return tickMs; }
+    configManager::DriveMode getDriveMode() const { return startMode; }
+    std::size_t getSampleCount() const { return sampleCount; }
+
+private:
+    std::uint32_t tickMs = 0;
+    configManager::DriveMode startMode = configManager::DriveMode::SplitArcade;
+    configManager::DriveMode currentMode = configManager::DriveMode::SplitArcade;
+    std::size_t sampleCount = 0;
+    std::size_t samplesRead = 0;
+    std::size_t offset = 0;
+    ControllerSample current;
+    std::vector<std::uint8_t> data;
+};
+
+bool replayRecording(const std::string &fileName, const std::function<bool()> &keepRunning);
+
+#endif /* INPUT_RECORDER_H */
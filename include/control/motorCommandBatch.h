@@ -0,0 +1,141 @@
+#ifndef MOTOR_COMMAND_BATCH_H
+#define MOTOR_COMMAND_BATCH_H
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+/**
+ * @class MotorCommandBatch
+ * @brief Collects voltage commands for a set of motors and writes them once per tick.
+ *
+ * Stages may set a motor's voltage any number of times during a tick; only the last value
+ * is kept. flush() then skips motors whose command moved less than the threshold since the
+ * value last written, but still rewrites every motor after `refreshTicks` so a motor that
+ * was unplugged and reconnected picks its command back up.
+ *
+ * @tparam Motor Anything with `spin(vex::directionType, double, vex::voltageUnits)` and
+ *               `stop(vex::brakeType)`, so a counting fake can stand in for vex::motor off the robot.
+ * @tparam Count Number of motors.
+ */
+template <typename Motor, std::size_t Count>
+class MotorCommandBatch
+{
+public:
+    explicit MotorCommandBatch(const std::array<Motor *, Count> &motors, double thresholdVolts = 0.05, std::uint32_t refreshTicks = 20)
+        : motors(motors), thresholdVolts(thresholdVolts), refreshTicks(refreshTicks) {}
+
+    void set(std::size_t index, double volts)
+    {
+        pending[index] = volts;
+        dirty[index] = true;
+    }
+
+    void setAll(const std::array<double, Count> &volts)
+    {
+        for (std::size_t i = 0; i < Count; ++i)
+        {
+            set(i, volts[i]);
+        }
+    }
+
+    /**
+     * @brief Writes the changed commands to the motors.
+     *
+     * @param nowMs Current time, used for the writes-per-second counter.
+     */
+    void flush(std::uint32_t nowMs)
+    {
+        bool refresh = ++ticksSinceRefresh >= refreshTicks;
+        for (std::size_t i = 0; i < Count; ++i)
+        {
+            if (!dirty[i])
+            {
+                continue;
+            }
+            dirty[i] = false;
+            // A stop (exactly 0 V) is always written so a small residual command cannot linger.
+            bool stopping = pending[i] == 0 && written[i] != 0;
+            if (!refresh && !stopping && hasWritten[i] && std::abs(pending[i] - written[i]) < thresholdVolts)
+            {
+                ++skippedWrites;
+                continue;
+            }
+            motors[i]->spin(vex::directionType::fwd, pending[i], vex::voltageUnits::volt);
+            written[i] = pending[i];
+            hasWritten[i] = true;
+            holding[i] = false;
+            ++totalWrites;
+            ++windowWrites;
+        }
+        if (refresh)
+        {
+            ticksSinceRefresh = 0;
+        }
+
+        if (nowMs - windowStartMs >= 1000)
+        {
+            writesPerSecond = windowWrites * 1000 / std::max<std::uint32_t>(nowMs - windowStartMs, 1);
+            windowWrites = 0;
+            windowStartMs = nowMs;
+        }
+    }
+
+    /**
+     * @brief Stops a motor with brakeType::hold in place of this tick's command.
+     *
+     * Repeated calls write nothing until a voltage has been written to the motor again.
+     */
+    void hold(std::size_t index)
+    {
+        dirty[index] = false;
+        if (holding[index])
+        {
+            return;
+        }
+        motors[index]->stop(vex::brakeType::hold);
+        holding[index] = true;
+        hasWritten[index] = false;
+        ++totalWrites;
+        ++windowWrites;
+    }
+
+    /**
+     * @brief Points one output at a different motor object, e.g. after the motor changed ports.
+     *
+     * The next command for it is written even if it matches the last value.
+     */
+    void rebind(std::size_t index, Motor *motor)
+    {
+        motors[index] = motor;
+        hasWritten[index] = false;
+        holding[index] = false;
+    }
+
+    /// @brief Forgets the last written values so the next flush writes every motor.
+    void invalidate() { hasWritten.fill(false); }
+
+    std::uint32_t getWritesPerSecond() const { return writesPerSecond; }
+    std::uint32_t getTotalWrites() const { return totalWrites; }
+    std::uint32_t getSkippedWrites() const { return skippedWrites; }
+
+private:
+    std::array<Motor *, Count> motors;
+    double thresholdVolts;
+    std::uint32_t refreshTicks;
+    std::uint32_t ticksSinceRefresh = 0;
+
+    std::array<double, Count> pending{};
+    std::array<double, Count> written{};
+    std::array<bool, Count> dirty{};
+    std::array<bool, Count> hasWritten{};
+    std::array<bool, Count> holding{};
+
+    std::uint32_t totalWrites = 0;
+    std::uint32_t skippedWrites = 0;
+    std::uint32_t windowWrites = 0;
+    std::uint32_t windowStartMs = 0;
+    std::uint32_t writesPerSecond = 0;
+};
+
+#endif /* MOTOR_COMMAND_BATCH_H */
@@ -0,0 +1,70 @@
+#ifndef ODOMETRY_H
+#define ODOMETRY_H
+
+/**
+ * @struct Pose
+ * @brief Robot position on the field.
+ *
+ * x is forward and y is left of the starting pose, in metres. theta is counter-clockwise
+ * positive in radians. velocity is the forward speed of the chassis centre in m/s.
+ */
+struct Pose
+{
+    double x = 0;
+    double y = 0;
+    double theta = 0;
+    double velocity = 0;
+    std::uint32_t timestampMs = 0;
+};
+
+/**
+ * @class Odometry
+ * @brief Arc-based pose integrator fusing drive encoders with the IMU heading.
+ *
+ * Each update treats the motion since the previous one as a circular arc: the arc length
+ * is the mean of the left and right wheel travel and the heading change comes from the
+ * InertialGyro (or the wheel difference when the IMU is not used). The resulting pose is
+ * published through a SeqLock so readers never block the odometry task.
+ *
+ * update() is the only writer of the pose. reset() may be called from any thread: it posts
+ * the new pose as a request that the next update() applies before integrating.
+ */
+class Odometry
+{
+public:
+    struct Settings
+    {
+        double wheelTravelMeters = wheelTravelMm / 1000.0;
+        double trackWidthMeters = trackWidthMm / 1000.0;
+        bool useImuHeading = true;
+    };
+
+    Odometry() = default;
+    explicit Odometry(const Settings &settings) : settings(settings) {}
+
+    void reset(const Pose &pose = Pose{});
+    void update(double leftRevs, double rightRevs, double imuHeadingRad, double dtSeconds, std::uint32_t timestampMs = 0);
+
+    Pose getPose() const { return published.read(); }
+    bool isResetPending() const { return resetPending.load(std::memory_order_acquire); }
+
+private:
+    Settings settings;
+    Pose state;
+    SeqLock<Pose> published;
+
+    SeqLock<Pose> requestedPose; ///< Written by reset() under resetMutex, read by update().
+    std::atomic<bool> resetPending{false};
+    vex::mutex resetMutex;
+
+    bool initialized = false;
+    double lastLeftRevs = 0;
+    double lastRightRevs = 0;
+    double lastImuHeading = 0;
+};
+
+extern Odometry DriveOdometry;
+
+void odometryTask();
+
+#endif /* ODOMETRY_H */
@@ -0,0 +1,49 @@
+#ifndef POWER_GOVERNOR_H
+#define POWER_GOVERNOR_H
+
+#include <array>
+
+/**
+ * @class PowerGovernor
+ * @brief Keeps the drivetrain's current draw within a budget so pushing cannot brown out the brain.
+ *
+ * Each motor's amps per volt is learned from its measured current and the voltage last sent to
+ * it, which covers both a free-spinning and a stalled motor. The command is split into its
+ * forward (common) and turn (differential) parts. The priority part gets the budget first;
+ * the other part is scaled to whatever predicted current is left. If the priority part alone
+ * is over budget, it is scaled down as well and the other part is dropped.
+ */
+class PowerGovernor
+{
+public:
+    struct Settings
+    {
+        double budgetAmps = 8;        ///< Total drivetrain current allowed.
+        configManager::DrivePriority priority = configManager::DrivePriority::Turn;
+        double filterWeight = 0.3;    ///< Weight of each new amps-per-volt reading.
+        double minLearnVolts = 1;     ///< Below this the reading is too noisy to learn from.
+        double initialAmpsPerVolt = 0.21; ///< A stalled V5 motor: 2.5 A at 12 V.
+    };
+
+    PowerGovernor() { reset(); }
+    explicit PowerGovernor(const Settings &settings) : settings(settings) { reset(); }
+
+    void apply(WheelVolts &wheelVolts, const std::array<double, WheelCount> &measuredAmps);
+    void reset();
+    void setSettings(const Settings &value) { settings = value; }
+
+    double getTotalAmps() const { return totalAmps; }
+    double getHeadroomAmps() const { return settings.budgetAmps - totalAmps; }
+    double getScale() const { return scale; }
+
+private:
+    Settings settings;
+    std::array<double, WheelCount> ampsPerVolt{};
+    std::array<double, WheelCount> lastVolts{};
+    double totalAmps = 0;
+    double scale = 1;
+
+    double predictAmps(const WheelVolts &wheelVolts) const;
+};
+
+#endif /* POWER_GOVERNOR_H */
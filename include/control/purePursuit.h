@@ -0,0 +1,57 @@
+#ifndef PURE_PURSUIT_H
+#define PURE_PURSUIT_H
+
+/**
+ * @class PurePursuit
+ * @brief Tracks a precomputed Trajectory from the odometry pose.
+ *
+ * Each update finds the closest sample (searching forward from the previous one), steers
+ * toward the first sample at least one lookahead distance away, and uses the profiled
+ * velocity of the closest sample as the forward speed.
+ */
+class PurePursuit
+{
+public:
+    struct Settings
+    {
+        double lookaheadMeters = 0.3;
+        double trackWidthMeters = trackWidthMm / 1000.0;
+        double minVelocity = 0.1;       ///< Keeps the robot moving off the start sample.
+        double endToleranceMeters = 0.03;
+        std::size_t searchWindow = 50;  ///< Samples searched past the previous closest one.
+    };
+
+    struct Output
+    {
+        double leftVelocity = 0;  ///< m/s
+        double rightVelocity = 0; ///< m/s
+        double crossTrackError = 0;
+        bool finished = false;
+    };
+
+    PurePursuit() = default;
+    explicit PurePursuit(const Settings &settings) : settings(settings) {}
+
+    void reset() { closestIndex = 0; }
+    Output update(const Pose &pose, const Trajectory &trajectory);
+
+private:
+    Settings settings;
+    std::size_t closestIndex = 0;
+};
+
+/**
+ * @struct FollowResult
+ * @brief Tracking quality of a completed trajectory run.
+ */
+struct FollowResult
+{
+    bool completed = false;
+    double maxCrossTrackError = 0;
+    double meanCrossTrackError = 0;
+    double elapsedSeconds = 0;
+};
+
+FollowResult followTrajectory(const Trajectory &trajectory, const std::function<bool()> &keepRunning);
+
+#endif /* PURE_PURSUIT_H */
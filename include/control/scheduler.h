@@ -0,0 +1,92 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * @class PeriodicScheduler
+ * @brief Runs control tasks on fixed-rate absolute deadlines.
+ *
+ * Each task has a period and a phase offset. Deadlines are computed as
+ * `start + phase + n * period`, so the compute time of an iteration does not
+ * stretch the period the way `work(); sleep_for(period);` does. Late starts
+ * are recorded as jitter and iterations that run past their next deadline are
+ * recorded as overruns. A task that overran runs again without waiting until it
+ * is back on its deadlines, so it keeps its rate, e.g. a replay runs as fast as
+ * it was recorded.
+ *
+ * All times are in microseconds. The clock is injectable so the scheduler can
+ * be driven by a virtual clock on the host.
+ */
+class PeriodicScheduler
+{
+public:
+    /**
+     * @struct Clock
+     * @brief Time source used by the scheduler.
+     */
+    struct Clock
+    {
+        std::uint64_t (*now)();                    ///< Current time in microseconds.
+        void (*sleepUntil)(std::uint64_t deadline); ///< Block until the given time in microseconds.
+    };
+
+    /**
+     * @struct TaskStats
+     * @brief Timing statistics collected for a single task.
+     */
+    struct TaskStats
+    {
+        std::uint32_t runs = 0;          ///< Number of completed iterations.
+        std::uint32_t overruns = 0;      ///< Iterations that finished after their next deadline.
+        std::uint32_t skippedPeriods = 0; ///< Whole periods dropped after falling more than maxCatchUpPeriods behind.
+        std::uint64_t maxJitterUs = 0;   ///< Worst start lateness.
+        std::uint64_t totalJitterUs = 0; ///< Sum of start lateness, for the mean.
+        std::uint64_t maxRuntimeUs = 0;  ///< Longest iteration.
+
+        std::uint64_t meanJitterUs() const { return runs ? totalJitterUs / runs : 0; }
+    };
+
+    using TaskFunction = std::function<void()>;
+
+    /// @brief How far, in periods, a task may fall behind and still run every missed iteration.
+    static constexpr std::uint64_t maxCatchUpPeriods = 2;
+
+    explicit PeriodicScheduler(const Clock &clock = systemClock());
+
+    std::size_t addTask(const std::string &name, std::uint32_t periodMs, std::uint32_t phaseMs, TaskFunction function);
+    void setPeriod(std::size_t taskId, std::uint32_t periodMs);
+
+    void runOnce();
+    void run(const std::function<bool()> &keepRunning);
+
+    const TaskStats &getStats(std::size_t taskId) const { return tasks[taskId].stats; }
+    const std::string &getName(std::size_t taskId) const { return tasks[taskId].name; }
+    std::size_t getTaskCount() const { return tasks.size(); }
+    void resetStats();
+    void logStats() const;
+
+    static const Clock &systemClock();
+
+private:
+    struct Task
+    {
+        std::string name;
+        std::uint64_t periodUs;
+        std::uint64_t phaseUs;
+        std::uint64_t nextDeadlineUs;
+        TaskFunction function;
+        TaskStats stats;
+    };
+
+    Clock clock;
+    std::vector<Task> tasks;
+    bool started = false;
+
+    void start();
+};
+
+#endif /* SCHEDULER_H */
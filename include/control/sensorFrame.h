@@ -0,0 +1,78 @@
+#ifndef SENSOR_FRAME_H
+#define SENSOR_FRAME_H
+
+#include <array>
+#include <cstdint>
+
+/**
+ * @enum ControllerButton
+ * @brief Bit positions of the buttons in a button mask, in createControllerButtonArray() order.
+ */
+enum class ControllerButton : std::uint8_t
+{
+    A,
+    B,
+    X,
+    Y,
+    Up,
+    Down,
+    Left,
+    Right,
+    L1,
+    L2,
+    R1,
+    R2
+};
+
+constexpr bool isPressed(std::uint16_t buttons, ControllerButton button)
+{
+    return (buttons >> static_cast<std::uint8_t>(button)) & 1u;
+}
+
+std::uint16_t readButtons(const vex::controller &controller);
+
+/**
+ * @struct MotorSample
+ * @brief One drive motor's readings for a control cycle.
+ */
+struct MotorSample
+{
+    double velocityRpm = 0;
+    double currentAmps = 0;
+    double positionRevs = 0;
+    double temperatureC = 0;
+};
+
+/**
+ * @struct SensorFrame
+ * @brief Everything the drive stages read, sampled once at the start of a control cycle.
+ *
+ * Stages take the frame by const reference instead of querying devices, so each device is
+ * read once per cycle and the stages can run on the host from recorded frames.
+ */
+struct SensorFrame
+{
+    std::uint32_t timestampMs = 0;
+    std::array<MotorSample, WheelCount> wheels{};
+
+    double yawRateDps = 0;    ///< Positive turning right.
+    double rotationDeg = 0;   ///< Continuous heading, positive turning right.
+    double forwardAccelG = 0; ///< Along imuForwardAxis.
+    bool collision = false;   ///< InertialGyro collision reported since the previous frame.
+
+    double obstacleDistanceM = -1; ///< Forward distance sensor, negative when nothing is seen.
+    bool rearBumperPressed = false;
+
+    StickSample sticks;
+    std::uint16_t buttons = 0;
+
+    const MotorSample &wheel(Wheel index) const { return wheels[static_cast<std::size_t>(index)]; }
+
+    double leftVelocityRpm() const { return (wheel(Wheel::FrontLeft).velocityRpm + wheel(Wheel::RearLeft).velocityRpm) / 2; }
+    double rightVelocityRpm() const { return (wheel(Wheel::FrontRight).velocityRpm + wheel(Wheel::RearRight).velocityRpm) / 2; }
+    double forwardSpeed() const { return (leftVelocityRpm() + rightVelocityRpm()) / 2 * wheelTravelMm / 1000.0 / 60.0; }
+};
+
+SensorFrame readSensorFrame(const vex::controller &controller);
+
+#endif /* SENSOR_FRAME_H */
@@ -0,0 +1,51 @@
+#ifndef SEQLOCK_H
+#define SEQLOCK_H
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @class SeqLock
+ * @brief Single-writer, many-reader publication of a small trivially copyable value.
+ *
+ * The writer never blocks. Readers retry if they observe an odd sequence number (a write in
+ * progress) or a sequence number that changed during their copy.
+ */
+template <typename T>
+class SeqLock
+{
+    static_assert(std::is_trivially_copyable_v<T>, "SeqLock values must be trivially copyable");
+
+public:
+    void write(const T &newValue)
+    {
+        std::uint32_t start = sequence.load(std::memory_order_relaxed);
+        sequence.store(start + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        value = newValue;
+        sequence.store(start + 2, std::memory_order_release);
+    }
+
+    T read() const
+    {
+        T copy;
+        std::uint32_t before, after;
+        do
+        {
+            before = sequence.load(std::memory_order_acquire);
+            copy = value;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            after = sequence.load(std::memory_order_relaxed);
+        } while ((before & 1) != 0 || before != after);
+        return copy;
+    }
+
+    std::uint32_t version() const { return sequence.load(std::memory_order_acquire); }
+
+private:
+    std::atomic<std::uint32_t> sequence{0};
+    T value{};
+};
+
+#endif /* SEQLOCK_H */
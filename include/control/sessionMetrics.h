@@ -0,0 +1,116 @@
+#ifndef SESSION_METRICS_H
+#define SESSION_METRICS_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @class SessionMetrics
+ * @brief Boot milestones and stick-to-motor latency for one run of the program.
+ *
+ * Milestones are stamped once, from whichever thread reaches them first. Latency runs from the
+ * moment the brain first sees a stick change to the motor write it causes. The button service
+ * samples the sticks faster than the drive ticks and stamps a change in noteControllerSticks();
+ * the drive tick that reads the change opens a probe from that stamp in noteInput(), so the wait
+ * for the tick and any missed ticks are part of the sample. The probe only stays open if the
+ * change moved the input pipeline's command (a change inside the deadzone does not), and is
+ * closed in noteOutput() by the first motor write from then on. The radio's own delay is not
+ * visible on the brain.
+ *
+ * The clock is injectable so a session can be replayed on the host with a virtual clock.
+ */
+class SessionMetrics
+{
+public:
+    /**
+     * @enum Milestone
+     * @brief Points of the boot and first drive, in the order they normally happen.
+     */
+    enum class Milestone : std::uint8_t
+    {
+        StaticInit,       ///< Global constructors ran.
+        ConfigStart,      ///< parseConfig() began.
+        ConfigEnd,        ///< parseConfig() finished.
+        GyroStart,        ///< Gyro calibration began.
+        GyroEnd,          ///< Gyro calibration finished.
+        BootReady,        ///< Every boot step finished.
+        FirstController,  ///< First packet from the primary controller.
+        FirstDriveTick,   ///< First userControl drive tick: the robot is drivable.
+        Count
+    };
+
+    /**
+     * @struct LatencyStats
+     * @brief Input-to-output samples in microseconds, bucketed by powers of two for percentiles.
+     */
+    struct LatencyStats
+    {
+        std::uint32_t samples = 0;
+        std::uint32_t unanswered = 0;  ///< Stick changes with no motor write within probeTimeoutUs.
+        std::uint32_t missedTicks = 0; ///< Drive ticks that never ran because the previous one ran late.
+        std::uint64_t minUs = 0;
+        std::uint64_t maxUs = 0;
+        std::uint64_t totalUs = 0;
+        std::array<std::uint32_t, 32> buckets{}; ///< buckets[i] counts samples below 2^i us.
+
+        std::uint64_t meanUs() const { return samples ? totalUs / samples : 0; }
+        std::uint64_t percentileUs(double fraction) const;
+    };
+
+    /// @brief Where the report of the last session is kept.
+    static constexpr const char *reportFileName = "session.txt";
+    /// @brief Smallest change of any stick axis, in percent, that starts a latency probe.
+    static constexpr int inputThreshold = 5;
+    /// @brief A probe with no motor write after this long counts as unanswered.
+    static constexpr std::uint64_t probeTimeoutUs = 500000;
+
+    explicit SessionMetrics(std::uint64_t (*now)() = systemNow);
+
+    void mark(Milestone milestone);
+    std::uint64_t getMilestoneUs(Milestone milestone) const { return milestones[static_cast<std::size_t>(milestone)].load(std::memory_order_acquire); }
+
+    void noteControllerSticks(const StickSample &sticks);
+    void noteInput(const StickSample &sticks, double tickSeconds);
+    void noteOutput(const DriveCommand &command, std::uint32_t totalWrites);
+    LatencyStats getLatency() const { return latency.read(); }
+
+    std::vector<std::string> reportLines() const;
+    bool save(const std::string &fileName) const;
+    static std::vector<std::string> loadReport(const std::string &fileName);
+
+    static std::uint64_t systemNow();
+
+private:
+    std::uint64_t (*now)();
+    std::array<std::atomic<std::uint64_t>, static_cast<std::size_t>(Milestone::Count)> milestones{};
+
+    // Button service thread only
+    StickSample serviceSticks;
+    bool serviceHasSticks = false;
+
+    /// First stick change the button service saw since the drive last read the sticks, 0 if none.
+    std::atomic<std::uint64_t> controllerChangeUs{0};
+
+    // Drive thread only
+    StickSample lastSticks;
+    bool hasSticks = false;
+    std::uint64_t lastInputUs = 0;
+    std::uint64_t pendingStartUs = 0; ///< A change read this tick, not yet known to move the command.
+    std::uint64_t probeStartUs = 0;   ///< 0 while no probe is open.
+    DriveCommand lastCommand;
+    bool hasCommand = false;
+    std::uint32_t lastWrites = 0;
+    LatencyStats stats;
+
+    static bool sticksChanged(const StickSample &previous, const StickSample &current);
+
+    SeqLock<LatencyStats> latency; ///< stats as of the last sample, for the report on other threads.
+};
+
+/// @brief Metrics of the running session.
+extern SessionMetrics Metrics;
+
+#endif // SESSION_METRICS_H
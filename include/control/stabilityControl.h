@@ -0,0 +1,52 @@
+#ifndef STABILITY_CONTROL_H
+#define STABILITY_CONTROL_H
+
+/**
+ * @class StabilityControl
+ * @brief Yaw-rate controller that cancels rotation the driver did not ask for.
+ *
+ * The turn stick is read as a commanded yaw rate. A PI loop on the difference between
+ * that and the InertialGyro yaw rate adds a differential correction to the turn voltage,
+ * so a bump or one side losing grip does not swing the robot. When the turn stick is
+ * centred while driving, the current heading is latched and held.
+ */
+class StabilityControl
+{
+public:
+    struct Settings
+    {
+        double maxVolts = 12;              ///< Turn voltage that maps to maxTurnRateDps.
+        double maxTurnRateDps = 600;       ///< Yaw rate commanded by full turn stick.
+        double rateKp = 0.04;              ///< Volts per dps of yaw rate error.
+        double rateKi = 0.2;               ///< Volts per dps*s of accumulated yaw rate error.
+        double headingKp = 5;              ///< dps of commanded yaw rate per degree of heading error.
+        double maxCorrectionVolts = 4;     ///< Limit on the correction added to the turn command.
+        double holdMinForwardVolts = 0.5;  ///< Heading hold only engages while driving.
+    };
+
+    struct Inputs
+    {
+        double forwardVolts = 0;
+        double turnVolts = 0;
+        double yawRateDps = 0;  ///< Measured yaw rate, positive turning right.
+        double rotationDeg = 0; ///< Continuous heading, positive turning right.
+        double dtSeconds = 0.025;
+    };
+
+    StabilityControl() = default;
+    explicit StabilityControl(const Settings &settings) : settings(settings) {}
+
+    double correctTurn(const Inputs &inputs);
+    void reset();
+
+    bool isHoldingHeading() const { return holdingHeading; }
+    double getHeldHeading() const { return heldHeading; }
+
+private:
+    Settings settings;
+    double integral = 0;
+    bool holdingHeading = false;
+    double heldHeading = 0;
+};
+
+#endif /* STABILITY_CONTROL_H */
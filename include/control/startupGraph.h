@@ -0,0 +1,88 @@
+#ifndef STARTUP_GRAPH_H
+#define STARTUP_GRAPH_H
+
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <list>
+#include <string>
+#include <vector>
+
+/**
+ * @class StartupGraph
+ * @brief Runs the boot steps on worker threads, each as soon as the steps it depends on are done.
+ *
+ * Steps only depend on steps added before them, so the graph cannot have a cycle. While the
+ * gyro calibrates, for example, the logo and the autonomous route are prepared on other workers
+ * instead of waiting their turn. The start and end of every step are recorded against the
+ * start of run() and written to the log as the boot timeline.
+ *
+ * No worker waits for work: a worker that finds nothing runnable ends, and the worker that
+ * finishes a step starts new workers for the steps it unblocked. run() blocks in join() until
+ * the last worker is done.
+ *
+ * The clock is injectable so the graph can be timed on the host, like PeriodicScheduler.
+ */
+class StartupGraph
+{
+public:
+    using StepFunction = std::function<void()>;
+
+    /**
+     * @struct StepTiming
+     * @brief When a step became runnable, started and finished, in microseconds since run() began.
+     */
+    struct StepTiming
+    {
+        std::uint64_t readyUs = 0; ///< When its last dependency finished.
+        std::uint64_t startUs = 0;
+        std::uint64_t endUs = 0;
+
+        std::uint64_t runtimeUs() const { return endUs - startUs; }
+    };
+
+    explicit StartupGraph(const PeriodicScheduler::Clock &clock = PeriodicScheduler::systemClock());
+
+    std::size_t addStep(const std::string &name, StepFunction function, std::initializer_list<std::size_t> dependencies = {});
+    void run(std::size_t workerCount = 4);
+
+    const StepTiming &getTiming(std::size_t stepId) const { return steps[stepId].timing; }
+    const std::string &getName(std::size_t stepId) const { return steps[stepId].name; }
+    std::size_t getStepCount() const { return steps.size(); }
+    std::uint64_t getTotalUs() const { return totalUs; }
+    void logTimeline() const;
+
+private:
+    enum class State : std::uint8_t
+    {
+        Waiting,
+        Running,
+        Done
+    };
+
+    struct Step
+    {
+        std::string name;
+        StepFunction function;
+        std::vector<std::size_t> dependencies;
+        State state = State::Waiting;
+        StepTiming timing;
+    };
+
+    bool isRunnable(const Step &step) const;
+    Step *takeRunnable();
+    void startWorkers();
+    void workLoop();
+    static int workerTask(void *arg);
+
+    PeriodicScheduler::Clock clock;
+    std::vector<Step> steps;
+    vex::mutex stepsMutex;        ///< Guards the step states, activeWorkers and workers.
+    std::list<vex::thread> workers; ///< Every worker run() started; a list so none moves while run() joins.
+    std::size_t workerLimit = 1;
+    std::size_t activeWorkers = 0;
+    std::uint64_t startUs = 0;
+    std::uint64_t totalUs = 0;
+};
+
+#endif // STARTUP_GRAPH_H
@@ -0,0 +1,103 @@
+#ifndef TRACTION_CONTROL_H
+#define TRACTION_CONTROL_H
+
+#include <array>
+
+/**
+ * @class ChassisSpeedEstimator
+ * @brief Chassis speed along the drive direction from wheel speeds and IMU acceleration.
+ *
+ * A complementary filter: the IMU forward acceleration is integrated for a short-term
+ * prediction, and the wheel speed closest to that prediction is used as the long-term
+ * reference (under acceleration the slowest wheel is the honest one, under braking the
+ * fastest). When every wheel is slipping, e.g. all four locked under hard braking, even the
+ * closest one is far from the prediction while the IMU feels the tyre forces, and the estimate
+ * then leans almost entirely on the IMU until a wheel grips again. Without that acceleration
+ * the wheels are trusted as usual, so a stale estimate still converges. Each wheel's expected speed is the chassis speed plus the yaw
+ * rate contribution of its side, so turning is not mistaken for slip.
+ */
+class ChassisSpeedEstimator
+{
+public:
+    struct Settings
+    {
+        double wheelTravelMeters = 0.31919; ///< Distance travelled per wheel revolution.
+        double trackWidthMeters = 0.320;    ///< Distance between left and right wheels.
+        double imuWeight = 0.9;             ///< Complementary filter weight of the IMU prediction.
+        double slippingImuWeight = 0.99;    ///< Weight used while every wheel may be slipping.
+        double wheelToleranceMs = 0.1;      ///< How far the closest wheel may be from the prediction and still count as rolling.
+        double slippingAccelG = 0.1;        ///< Acceleration the tyres must be transmitting before all of them can be slipping.
+    };
+
+    ChassisSpeedEstimator() = default;
+    explicit ChassisSpeedEstimator(const Settings &settings) : settings(settings) {}
+
+    void update(const std::array<double, WheelCount> &wheelRpm, double forwardAccelG, double yawRateDps, double dtSeconds);
+    void reset() { speed = 0; }
+
+    double getSpeed() const { return speed; }                                                ///< m/s, positive forward.
+    double getWheelSpeed(std::size_t wheel) const { return wheelSpeeds[wheel]; }             ///< Measured surface speed, m/s.
+    double getExpectedSpeed(std::size_t wheel) const { return speed + turnOffsets[wheel]; } ///< Ground speed under the wheel, m/s.
+
+private:
+    Settings settings;
+    double speed = 0;
+    std::array<double, WheelCount> wheelSpeeds{};
+    std::array<double, WheelCount> turnOffsets{};
+};
+
+/**
+ * @class TractionControl
+ * @brief Per-wheel slip limiter driven by wheel speed and IMU acceleration.
+ *
+ * The ground speed under each wheel comes from a ChassisSpeedEstimator. Slip is measured in
+ * the direction the wheel is driven, so a wheel spinning up faster than the robot moves has
+ * its command reduced and wheels that are not slipping keep the driver's command. A wheel
+ * braking against the motion is left to AntiLockBraking.
+ */
+class TractionControl
+{
+public:
+    struct Settings
+    {
+        double wheelTravelMeters = 0.31919; ///< Distance travelled per wheel revolution.
+        double trackWidthMeters = 0.320;    ///< Distance between left and right wheels.
+        double targetSlip = 0.15;           ///< Slip ratio allowed before the command is reduced.
+        double slipGain = 2.5;              ///< Command reduction per unit of slip above target.
+        double minScale = 0.2;              ///< Lowest fraction of the driver's command that is kept.
+        double recoveryPerSecond = 4.0;     ///< How fast a reduced wheel returns to full command.
+        double imuWeight = 0.9;             ///< Complementary filter weight of the IMU prediction.
+        double minSpeed = 0.05;             ///< m/s below which slip is not evaluated.
+
+        ChassisSpeedEstimator::Settings estimatorSettings() const
+        {
+            return {.wheelTravelMeters = wheelTravelMeters, .trackWidthMeters = trackWidthMeters, .imuWeight = imuWeight};
+        }
+    };
+
+    struct Inputs
+    {
+        std::array<double, WheelCount> wheelRpm{}; ///< Measured wheel velocities, Wheel order.
+        double forwardAccelG = 0;                  ///< IMU acceleration along the drive direction.
+        double yawRateDps = 0;                     ///< IMU yaw rate, positive turning right.
+        double dtSeconds = 0.025;
+    };
+
+    TractionControl() = default;
+    explicit TractionControl(const Settings &settings) : settings(settings), estimator(settings.estimatorSettings()) {}
+
+    void apply(WheelVolts &command, const Inputs &inputs);
+    void reset();
+
+    double getChassisSpeed() const { return estimator.getSpeed(); }
+    double getSlip(Wheel wheel) const { return slip[static_cast<std::size_t>(wheel)]; }
+    double getScale(Wheel wheel) const { return scale[static_cast<std::size_t>(wheel)]; }
+
+private:
+    Settings settings;
+    ChassisSpeedEstimator estimator;
+    std::array<double, WheelCount> slip{};
+    std::array<double, WheelCount> scale{1, 1, 1, 1};
+};
+
+#endif /* TRACTION_CONTROL_H */
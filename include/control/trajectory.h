@@ -0,0 +1,77 @@
+#ifndef TRAJECTORY_H
+#define TRAJECTORY_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @struct Waypoint
+ * @brief A point the path must pass through, in metres.
+ */
+struct Waypoint
+{
+    double x;
+    double y;
+};
+
+/**
+ * @struct TrajectoryConstraints
+ * @brief Limits used to time-parameterize a path.
+ */
+struct TrajectoryConstraints
+{
+    double maxVelocity = 1.5;         ///< m/s
+    double maxAcceleration = 2.0;     ///< m/s^2, used for both speeding up and slowing down.
+    double maxLateralAcceleration = 2.0; ///< m/s^2, caps speed through curves.
+    double sampleSpacing = 0.02;      ///< Target distance between samples in metres.
+};
+
+/**
+ * @struct TrajectorySample
+ * @brief One entry of a precomputed trajectory table.
+ *
+ * Stored as floats to keep tables small in memory and on the SD card.
+ */
+struct TrajectorySample
+{
+    float x;
+    float y;
+    float heading;   ///< Radians, counter-clockwise positive.
+    float curvature; ///< 1/m, positive turning left.
+    float velocity;  ///< m/s
+    float time;      ///< Seconds from the start of the trajectory.
+};
+
+/**
+ * @class Trajectory
+ * @brief Time-parameterized path stored as a sample table.
+ *
+ * Paths are Catmull-Rom splines through the waypoints. Each sample's speed is capped by the
+ * lateral acceleration limit for its curvature, then forward and backward passes apply the
+ * acceleration limit, giving a trapezoidal profile. Generation is meant to run before the
+ * match; tables can be cached on the SD card and are validated against a hash of the
+ * waypoints and constraints.
+ */
+class Trajectory
+{
+public:
+    static Trajectory generate(const std::vector<Waypoint> &waypoints, const TrajectoryConstraints &constraints);
+    static std::uint32_t hashInputs(const std::vector<Waypoint> &waypoints, const TrajectoryConstraints &constraints);
+
+    bool save(const std::string &fileName) const;
+    bool load(const std::string &fileName, std::uint32_t expectedHash);
+
+    const std::vector<TrajectorySample> &getSamples() const { return samples; }
+    bool isReady() const { return !samples.empty(); }
+    double getDuration() const { return samples.empty() ? 0 : samples.back().time; }
+    std::uint32_t getHash() const { return hash; }
+
+private:
+    std::vector<TrajectorySample> samples;
+    std::uint32_t hash = 0;
+};
+
+Trajectory loadOrGenerateTrajectory(const std::string &fileName, const std::vector<Waypoint> &waypoints, const TrajectoryConstraints &constraints);
+
+#endif /* TRAJECTORY_H */
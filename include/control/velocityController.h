@@ -0,0 +1,34 @@
+#ifndef VELOCITY_CONTROLLER_H
+#define VELOCITY_CONTROLLER_H
+
+/**
+ * @class VelocityController
+ * @brief Feedforward plus PI velocity loop for one side of the drivetrain.
+ *
+ * The feedforward `kS * sign(v) + kV * v + kA * a` supplies most of the voltage, so the PI
+ * terms only correct for load and battery sag. The integrator is frozen while the output is
+ * saturated in the direction of the error and is clamped to the voltage range, so it cannot
+ * wind up while the robot is pushing against something.
+ */
+class VelocityController
+{
+public:
+    explicit VelocityController(const configManager::VelocityGains &gains = configManager::VelocityGains{}, double maxVolts = 12)
+        : gains(gains), maxVolts(maxVolts) {}
+
+    void setGains(const configManager::VelocityGains &value) { gains = value; }
+    double update(double targetRpm, double measuredRpm, double dtSeconds);
+    void reset();
+
+    double getIntegral() const { return integral; }
+    bool isSaturated() const { return saturated; }
+
+private:
+    configManager::VelocityGains gains;
+    double maxVolts;
+    double integral = 0;
+    double lastTarget = 0;
+    bool saturated = false;
+};
+
+#endif /* VELOCITY_CONTROLLER_H */
@@ -0,0 +1,44 @@
+#ifndef WHEEL_COMMAND_H
+#define WHEEL_COMMAND_H
+
+#include <array>
+#include <cstddef>
+
+/**
+ * @enum Wheel
+ * @brief Index of each drive motor in per-wheel arrays.
+ */
+enum class Wheel : std::size_t
+{
+    FrontLeft,
+    RearLeft,
+    FrontRight,
+    RearRight
+};
+
+constexpr std::size_t WheelCount = 4;
+
+/**
+ * @struct WheelVolts
+ * @brief Voltage command for each drive motor, indexed by Wheel.
+ */
+struct WheelVolts
+{
+    std::array<double, WheelCount> volts{};
+
+    double &operator[](Wheel wheel) { return volts[static_cast<std::size_t>(wheel)]; }
+    double operator[](Wheel wheel) const { return volts[static_cast<std::size_t>(wheel)]; }
+
+    static WheelVolts fromSides(double leftVolts, double rightVolts)
+    {
+        return WheelVolts{{leftVolts, leftVolts, rightVolts, rightVolts}};
+    }
+};
+
+/// @brief True for the wheels on the left side of the drivetrain.
+constexpr bool isLeftWheel(std::size_t wheel)
+{
+    return wheel == static_cast<std::size_t>(Wheel::FrontLeft) || wheel == static_cast<std::size_t>(Wheel::RearLeft);
+}
+
+#endif /* WHEEL_COMMAND_H */
@@ -0,0 +1,104 @@
+#ifndef BUTTON_SERVICE_H
+#define BUTTON_SERVICE_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/**
+ * @struct ButtonEvent
+ * @brief A button edge or hold event from one of the controllers.
+ */
+struct ButtonEvent
+{
+    enum class Type : std::uint8_t
+    {
+        Press,     ///< Button went down.
+        Release,   ///< Button went up. heldMs is how long it was down.
+        LongPress, ///< Button has been held for the long-press time. Sent once per press.
+        Repeat     ///< Sent periodically while a button stays held, for scrolling.
+    };
+
+    Type type = Type::Press;
+    std::uint8_t controllerIndex = 0; ///< 0 for primaryController, 1 for partnerController.
+    ControllerButton button = ControllerButton::A;
+    std::uint32_t timestampMs = 0;
+    std::uint32_t heldMs = 0;
+};
+
+const char *buttonName(ControllerButton button);
+
+/**
+ * @class ButtonEventDetector
+ * @brief Turns successive button masks of one controller into ButtonEvents.
+ */
+class ButtonEventDetector
+{
+public:
+    struct Settings
+    {
+        std::uint32_t longPressMs = 1000;
+        std::uint32_t repeatDelayMs = 500;
+        std::uint32_t repeatIntervalMs = 150;
+    };
+
+    ButtonEventDetector() = default;
+    explicit ButtonEventDetector(const Settings &settings) : settings(settings) {}
+
+    void update(std::uint16_t buttons, std::uint32_t nowMs, std::uint8_t controllerIndex, const std::function<void(const ButtonEvent &)> &emit);
+
+private:
+    Settings settings;
+    std::uint16_t previous = 0;
+    std::array<std::uint32_t, 12> pressedAt{};
+    std::array<std::uint32_t, 12> nextRepeatAt{};
+    std::uint16_t longPressSent = 0;
+};
+
+/**
+ * @class ButtonService
+ * @brief Background sampler for the buttons of both controllers.
+ *
+ * A dedicated thread reads both controllers as bitmasks at a fixed rate, detects events and
+ * pushes them to a lock-free queue. Subscriber callbacks run on the service thread and must
+ * not block. Callers either poll() or waitFor() an event with a timeout, so nothing stalls
+ * for longer than it asks to.
+ *
+ * The queue has a single consumer: only one thread at a time should poll or wait. A thread
+ * that polls or waits while another one is doing so gets no event, and the overlap is logged.
+ */
+class ButtonService
+{
+public:
+    using Subscriber = std::function<void(const ButtonEvent &)>;
+
+    void start(std::uint32_t pollMs = 10);
+    void subscribe(const Subscriber &subscriber);
+
+    bool poll(ButtonEvent &event);
+    bool waitFor(ButtonEvent &event, std::uint32_t timeoutMs);
+    void clear();
+
+    std::uint16_t getState(std::uint8_t controllerIndex) const { return state[controllerIndex].load(std::memory_order_acquire); }
+    bool isRunning() const { return running; }
+
+private:
+    EventQueue<ButtonEvent, 64> events;
+    std::array<std::atomic<std::uint16_t>, 2> state{};
+    std::array<ButtonEventDetector, 2> detectors;
+    std::vector<Subscriber> subscribers;
+    std::uint32_t pollMs = 10;
+    bool running = false;
+    std::atomic<bool> consuming{false};
+    std::atomic<bool> overlapReported{false};
+
+    bool beginConsuming();
+    void endConsuming() { consuming.store(false, std::memory_order_release); }
+    static int serviceTask(void *arg);
+};
+
+/// @brief Button events for both controllers. Started at the top of main().
+extern ButtonService Buttons;
+
+#endif /* BUTTON_SERVICE_H */
@@ -0,0 +1,62 @@
+#ifndef EVENT_QUEUE_H
+#define EVENT_QUEUE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @class EventQueue
+ * @brief Fixed-size lock-free ring buffer for one producer thread and one consumer thread.
+ *
+ * push() never blocks; when the queue is full the new event is dropped and counted.
+ *
+ * @tparam T Event type.
+ * @tparam Capacity Number of slots. Must be a power of two.
+ */
+template <typename T, std::size_t Capacity>
+class EventQueue
+{
+    static_assert((Capacity & (Capacity - 1)) == 0, "EventQueue capacity must be a power of two");
+
+public:
+    bool push(const T &event)
+    {
+        std::size_t tail = tailIndex.load(std::memory_order_relaxed);
+        if (tail - headIndex.load(std::memory_order_acquire) >= Capacity)
+        {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        slots[tail & (Capacity - 1)] = event;
+        tailIndex.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(T &event)
+    {
+        std::size_t head = headIndex.load(std::memory_order_relaxed);
+        if (head == tailIndex.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+        event = slots[head & (Capacity - 1)];
+        headIndex.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Discards everything queued so far. Consumer side only.
+    void clear() { headIndex.store(tailIndex.load(std::memory_order_acquire), std::memory_order_release); }
+
+    bool empty() const { return headIndex.load(std::memory_order_acquire) == tailIndex.load(std::memory_order_acquire); }
+    std::uint32_t getDropped() const { return dropped.load(std::memory_order_relaxed); }
+
+private:
+    std::array<T, Capacity> slots{};
+    std::atomic<std::size_t> headIndex{0};
+    std::atomic<std::size_t> tailIndex{0};
+    std::atomic<std::uint32_t> dropped{0};
+};
+
+#endif /* EVENT_QUEUE_H */
@@ -0,0 +1,91 @@
+#ifndef OPTION_MENU_H
+#define OPTION_MENU_H
+
+#include <array>
+#include <atomic>
+#include <string>
+#include <vector>
+
+/**
+ * @class OptionMenu
+ * @brief Controller option menu as a state machine advanced by ButtonEvents.
+ *
+ * A, B, X and Y pick the visible options, Down and Up scroll when there are more options than
+ * buttons, and Left cancels when the menu was opened as cancellable. handle() never blocks and
+ * render() only redraws after a change, so the menu can be driven from any loop: getUserOption
+ * waits on it before the match, and the driver control UI task steps it while the drive keeps
+ * running.
+ */
+class OptionMenu
+{
+public:
+    enum class State
+    {
+        Closed,
+        Open,
+        Selected,
+        Cancelled
+    };
+
+    /// @brief What a single event did to the menu.
+    enum class Action
+    {
+        None,     ///< Not a press on the primary controller, or the menu is not open.
+        Scrolled,
+        Selected,
+        Cancelled,
+        Invalid   ///< A press that does not map to a visible option.
+    };
+
+    void open(const std::string &title, const std::vector<std::string> &options, bool cancellable = false);
+    void close() { state = State::Closed; }
+
+    Action handle(const ButtonEvent &event);
+    bool render(vex::controller &controller);
+
+    State getState() const { return state; }
+    bool isOpen() const { return state == State::Open; }
+    std::size_t getSelection() const { return selection; }
+    const std::string &getSelectedOption() const { return options[selection]; }
+
+private:
+    static constexpr std::array<ControllerButton, 4> selectButtons = {ControllerButton::A, ControllerButton::B, ControllerButton::X, ControllerButton::Y};
+
+    std::string title;
+    std::vector<std::string> options;
+    bool cancellable = false;
+    State state = State::Closed;
+    std::size_t offset = 0;
+    std::size_t selection = 0;
+    bool dirty = false;
+
+    std::size_t visibleCount() const { return std::min(options.size() - offset, selectButtons.size()); }
+};
+
+/**
+ * @class DriveModeMenu
+ * @brief The driver control drive mode menu and its hand-off to the drive tick.
+ *
+ * The UI task feeds it button events and draws it; Up opens it. A chosen mode is saved on the
+ * UI task and parked until the drive tick calls applyPendingMode() at the start of its next
+ * iteration, so the mode never changes halfway through a tick.
+ */
+class DriveModeMenu
+{
+public:
+    void handle(const ButtonEvent &event);
+    bool render(vex::controller &controller) { return menu.render(controller); }
+    void close();
+
+    bool isOpen() const { return open.load(std::memory_order_acquire); }
+    /// @brief Whether the drive tick should ignore the sticks: the menu is open and MENUSTOPSDRIVE is set.
+    bool holdsDrive() const { return isOpen() && ConfigManager.getMenuStopsDrive(); }
+    bool applyPendingMode(DriveSystem &drive);
+
+private:
+    OptionMenu menu;
+    std::atomic<bool> open{false};
+    std::atomic<int> pendingMode{-1};
+};
+
+#endif /* OPTION_MENU_H */
@@ -4,19 +4,56 @@
 #include "v5_cpp.h"
 
 #include "config/robot-config.h"
+#include "config/extern/configKeyIndex.h"
+#include "config/extern/configSchema.h"
+#include "config/deviceSlot.h"
+#include "control/seqlock.h"
+#include "config/extern/maintenanceJournal.h"
+#include "config/extern/configFileStore.h"
 #include "config/extern/configManager.h"
+#include "config/deviceRegistry.h"
 
 #include "display/gifdec.h"
 
+#include "control/scheduler.h"
+#include "control/startupGraph.h"
+#include "config/preflightCheck.h"
+#include "control/inputPipeline.h"
+#include "control/wheelCommand.h"
+#include "control/sensorFrame.h"
+#include "control/tractionControl.h"
+#include "control/antiLockBraking.h"
+#include "control/stabilityControl.h"
+#include "control/emergencyBraking.h"
+#include "control/powerGovernor.h"
+#include "control/velocityController.h"
+#include "control/sessionMetrics.h"
+#include "control/odometry.h"
+#include "control/trajectory.h"
+#include "control/purePursuit.h"
+#include "control/motorCommandBatch.h"
+#include "control/driveSystem.h"
+#include "control/inputRecorder.h"
+
+#include "input/eventQueue.h"
+#include "input/buttonService.h"
+#include "input/optionMenu.h"
+
 extern std::string Version;
 extern std::string BuildDate;
+extern const std::vector<Waypoint> autonomousWaypoints;
 
 void logHandler(const std::string &functionName, const std::string &message, const Log::Level level, const float &timeOfDisplay = 2);
 void SD_Card_Logging(const Log::Level &level, const std::string &functionName, const std::string &message);
+bool logDeferred(const std::string &functionName, const std::string &message, const Log::Level level, const float &timeOfDisplay = 2);
+void flushDeferredLogs();
+void startDeferredLogging();
 std::string getUserOption(const std::string &settingName, const std::vector<std::string> &options);
 void calibrateGyro();
+bool runPreflight();
+void showPreflightSummary();
+void prepareAutonomous();
 void autonomous();
 void userControl();
 void motorMonitor();
-std::map<std::string, std::vector<int>> controllerButtonsPressed(const vex::controller &controller);
 void gifplayer(bool enableVsync = false);
\ No newline at end of file
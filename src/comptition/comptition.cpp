@@ -1,21 +1,48 @@
 #include "vex.h"
+#include <memory>
+
+// Autonomous route. Generated (or loaded from the SD card cache) before the match so no
+// time is spent on it inside the autonomous period.
+const std::vector<Waypoint> autonomousWaypoints = {{0, 0}, {0.6, 0}, {1.2, 0.6}};
+Trajectory autonomousRoute;
+
+// Driver runs recorded with RECORDINPUT=true and replayed with AUTONMODE=Replay.
+const std::string replayFileName = "replay.bin";
+
+/**
+ * @brief Prepares the autonomous trajectory. Call during pre-auton, before autonomous() can run.
+ */
+void prepareAutonomous()
+{
+    autonomousRoute = loadOrGenerateTrajectory("auto_route.bin", autonomousWaypoints, TrajectoryConstraints{});
+}
 
 void autonomous()
 {
-    logHandler("autonomous", "Test message.", Log::Level::Warn, 2);
+    if (ConfigManager.getAutonMode() == configManager::AutonMode::Replay)
+    {
+        replayRecording(replayFileName, []()
+                        { return !Competition.isDriverControl(); });
+        return;
+    }
+
+    if (!autonomousRoute.isReady())
+    {
+        logHandler("autonomous", "Autonomous route was not prepared before the match.", Log::Level::Error, 2);
+        return;
+    }
+
+    followTrajectory(autonomousRoute, []()
+                     { return !Competition.isDriverControl(); });
     return;
 }
 
 void collision(const vex::axisType axis, const double x, const double y, const double z)
 {
+    reportCollision(); // Picked up by emergency braking on the next drive tick
     printf("collision %d %6.2f %6.2f %6.2f\n", (int)axis, x, y, z);
 }
 
-// Drive system flags
-bool tractionControlEnabled = true;
-bool stabilityControlEnabled = true;
-bool absEnabled = true;
-
 /**
  * @author @DVT7125
  * @date 4/10/24
@@ -28,80 +55,37 @@ void displaySystemStates()
 {
     Brain.Screen.clearScreen();
     Brain.Screen.setCursor(1, 1);
-    Brain.Screen.print("Traction Control: %s\nStability Control: %s\nABS: %s",
+    Brain.Screen.print("Traction Control: %s\nStability Control: %s\nABS: %s\nAEB: %s",
                        tractionControlEnabled ? "ON" : "OFF",
                        stabilityControlEnabled ? "ON" : "OFF",
-                       absEnabled ? "ON" : "OFF");
-}
-
-// Function to apply traction control
-void applyTractionControl(double &forwardVolts)
-{
-    double frontLeftMotorRPM = frontLeftMotor.velocity(vex::velocityUnits::rpm);
-    double rearLeftMotorRPM = rearLeftMotor.velocity(vex::velocityUnits::rpm);
-    double frontRightMotorRPM = frontRightMotor.velocity(vex::velocityUnits::rpm);
-    double rearRightMotorRPM = rearRightMotor.velocity(vex::velocityUnits::rpm);
-
-    double minSpeed = std::min({std::abs(frontLeftMotorRPM), std::abs(rearLeftMotorRPM), std::abs(frontRightMotorRPM), std::abs(rearRightMotorRPM)});
-
-    forwardVolts = minSpeed;
-}
-
-// Function to apply stability control
-void applyStabilityControl(const double &forwardVolts)
-{
-    double leftRPM = LeftDriveSmart.velocity(vex::velocityUnits::rpm);
-    double rightRPM = RightDriveSmart.velocity(vex::velocityUnits::rpm);
-
-    double minSpeed = std::min(std::abs(leftRPM), std::abs(rightRPM));
-
-    LeftDriveSmart.spin(vex::directionType::fwd, minSpeed, vex::voltageUnits::volt);
-    RightDriveSmart.spin(vex::directionType::fwd, minSpeed, vex::voltageUnits::volt);
+                       absEnabled ? "ON" : "OFF",
+                       aebEnabled ? "ON" : "OFF");
 }
 
-// Function to apply ABS
-void applyABS(double &brakeVolts)
-{
-    double frontLeftMotorRPM = frontLeftMotor.velocity(vex::velocityUnits::rpm);
-    double rearLeftMotorRPM = rearLeftMotor.velocity(vex::velocityUnits::rpm);
-    double frontRightMotorRPM = frontRightMotor.velocity(vex::velocityUnits::rpm);
-    double rearRightMotorRPM = rearRightMotor.velocity(vex::velocityUnits::rpm);
-
-    double minSpeed = std::min({std::abs(frontLeftMotorRPM), std::abs(rearLeftMotorRPM), std::abs(frontRightMotorRPM), std::abs(rearRightMotorRPM)});
-
-    brakeVolts = minSpeed;
-}
+// Drive mode menu shared between the UI task and the drive tick.
+static DriveModeMenu driveModeMenu;
 
-// Function to display drive mode menu
-void displayDriveModeMenu()
+/**
+ * @brief Driver control UI task: runs the drive mode menu off the control loop.
+ *
+ * Consumes button events and steps the menu with them. The chosen mode is saved here, away
+ * from the drive tick, which applies it at the start of its next iteration.
+ */
+static int driveModeMenuTask()
 {
-    primaryController.Screen.clearScreen();
-    primaryController.Screen.setCursor(1, 1);
-    getUserOption("Drive Mode", {"Left Arcade", "Right Arcade", "Split Arcade", "Tank"});
+    Buttons.clear();
 
-    auto buttonPressDurations = controllerButtonsPressed(primaryController);
-    std::string buttonPressed;
-
-    if (buttonPressed == "A")
-    {
-        ConfigManager.setDriveMode(configManager::DriveMode::LeftArcade);
-    }
-    else if (buttonPressed == "B")
-    {
-        ConfigManager.setDriveMode(configManager::DriveMode::RightArcade);
-    }
-    else if (buttonPressed == "X")
-    {
-        ConfigManager.setDriveMode(configManager::DriveMode::SplitArcade);
-    }
-    else if (buttonPressed == "Y")
+    while (Competition.isEnabled())
     {
-        ConfigManager.setDriveMode(configManager::DriveMode::Tank);
+        ButtonEvent event;
+        if (Buttons.waitFor(event, 50))
+        {
+            driveModeMenu.handle(event);
+        }
+        driveModeMenu.render(primaryController);
     }
-
-    primaryController.Screen.clearScreen();
-    primaryController.Screen.setCursor(1, 1);
-    primaryController.Screen.print("Drive Mode Selected");
+    driveModeMenu.close();
+    return 0;
 }
 
 // User control task
@@ -113,118 +97,93 @@ void userControl()
     }
 
     vex::thread motortemp(motorMonitor);
-    InertialGyro.collision(collision);
-
-    double turnVolts, forwardVolts;
+    vex::thread menuThread(driveModeMenuTask);
+    Devices.inertial().collision(collision);
 
-    bool configMenuActive = false; // Tracks if options menu is active
+    // Load drive mode from config and specialize the drive pipeline for it
+    const std::uint32_t tickMs = ConfigManager.getCtrlr1PollingRate();
+    DriveSystem drive(tickMs);
 
-    // Load drive mode from config
-    configManager::DriveMode currentDriveMode = ConfigManager.getDriveMode();
+    std::unique_ptr<InputRecorder> recorder;
+    if (ConfigManager.getRecordInput())
+    {
+        recorder = std::make_unique<InputRecorder>(tickMs, drive.getDriveMode());
+        logHandler("userControl", "Recording driver input for replay.", Log::Level::Info);
+    }
 
-    int leftDeadzone = ConfigManager.getLeftDeadzone();
-    int rightDeadzone = ConfigManager.getRightDeadzone();
+    PeriodicScheduler scheduler;
+    std::size_t driveTaskId = 0;
+    std::uint32_t liveRevision = ConfigManager.getLiveRevision();
+    bool firstTick = true;
 
-    while (Competition.isEnabled())
+    auto driveTick = [&]()
     {
-        // Open configuration menu
-        if (primaryController.ButtonUp.pressing())
+        if (firstTick)
         {
-            configMenuActive = !configMenuActive;
-            if (configMenuActive)
-            {
-                displayDriveModeMenu();
-                currentDriveMode = ConfigManager.getDriveMode(); // Update currentDriveMode after selection
-            }
+            Metrics.mark(SessionMetrics::Milestone::FirstDriveTick);
+            firstTick = false;
         }
 
-        switch (currentDriveMode)
+        // Settings reloaded by the config watcher take effect here, between ticks.
+        if (const std::uint32_t revision = ConfigManager.getLiveRevision(); revision != liveRevision)
         {
-        case configManager::DriveMode::LeftArcade:
-            turnVolts = primaryController.Axis4.position() * 0.12; // -12 to 12
-            forwardVolts = primaryController.Axis3.position() * 0.12;
-            // Apply deadzones
-            if (std::abs(primaryController.Axis3.position()) < leftDeadzone)
-            {
-                forwardVolts = 0;
-            }
-            if (std::abs(primaryController.Axis4.position()) < rightDeadzone)
-            {
-                turnVolts = 0;
-            }
-            break;
-
-        case configManager::DriveMode::RightArcade:
-            turnVolts = primaryController.Axis1.position() * 0.12; // -12 to 12
-            forwardVolts = primaryController.Axis2.position() * 0.12;
-            // Apply deadzones
-            if (std::abs(primaryController.Axis2.position()) < leftDeadzone)
+            liveRevision = revision;
+            std::uint32_t newTickMs = ConfigManager.getCtrlr1PollingRate();
+            if (recorder && newTickMs != tickMs)
             {
-                forwardVolts = 0;
+                // A recording replays at the rate it was recorded at. The controller message is
+                // shown by the log thread; the tick must not wait for it.
+                logDeferred("userControl", "CTRLR1POLLINGRATE changes are ignored while recording input.", Log::Level::Warn, 3);
+                newTickMs = tickMs;
             }
-            if (std::abs(primaryController.Axis1.position()) < rightDeadzone)
-            {
-                turnVolts = 0;
-            }
-            break;
+            drive.reloadSettings(newTickMs);
+            scheduler.setPeriod(driveTaskId, newTickMs);
+        }
 
-        case configManager::DriveMode::SplitArcade:
-            turnVolts = primaryController.Axis1.position() * 0.12; // -12 to 12
-            forwardVolts = primaryController.Axis3.position() * 0.12;
-            // Apply deadzones
-            if (std::abs(primaryController.Axis3.position()) < leftDeadzone)
-            {
-                forwardVolts = 0;
-            }
-            if (std::abs(primaryController.Axis1.position()) < rightDeadzone)
-            {
-                turnVolts = 0;
-            }
-            break;
+        // A mode picked in the menu takes effect here, between ticks, never halfway through one.
+        driveModeMenu.applyPendingMode(drive);
 
-        case configManager::DriveMode::Tank:
-            double leftVolts = primaryController.Axis3.position() * 0.12;  // -12 to 12
-            double rightVolts = primaryController.Axis2.position() * 0.12; // -12 to 12
+        SensorFrame frame = readSensorFrame(primaryController);
+        Metrics.noteInput(frame.sticks, drive.getTickSeconds());
 
-            // Apply deadzones
-            if (std::abs(primaryController.Axis3.position()) < leftDeadzone)
-            {
-                leftVolts = 0;
-            }
-            if (std::abs(primaryController.Axis2.position()) < rightDeadzone)
-            {
-                rightVolts = 0;
-            }
-
-            LeftDriveSmart.spin(vex::directionType::fwd, leftVolts, vex::voltageUnits::volt);
-            RightDriveSmart.spin(vex::directionType::fwd, rightVolts, vex::voltageUnits::volt);
-            break;
-        }
-        if (currentDriveMode != configManager::DriveMode::Tank)
+        // Optionally keep the robot still while the driver is looking at the menu.
+        if (driveModeMenu.holdsDrive())
         {
+            frame.sticks = StickSample{};
+        }
 
-            // Apply traction control if enabled
-            if (tractionControlEnabled)
-            {
-                applyTractionControl(forwardVolts);
-            }
-
-            // Apply stability control if enabled
-            if (stabilityControlEnabled)
-            {
-                applyStabilityControl(forwardVolts);
-            }
+        if (recorder)
+        {
+            recorder->record(ControllerSample{frame.sticks, frame.buttons}, drive.getDriveMode());
+        }
 
-            // Apply ABS if enabled
-            if (absEnabled)
-            {
-                applyABS(forwardVolts);
-            }
+        drive.tick(frame);
+        Metrics.noteOutput(drive.getInputCommand(), drive.getDeviceWrites());
+    };
+
+    // Drive runs at the configured controller rate on absolute deadlines; the stats task is
+    // phase shifted so it never lands on the same tick as the first drive iteration. It only
+    // queues its lines: the log thread does the SD card writes.
+    driveTaskId = scheduler.addTask("drive", tickMs, 0, driveTick);
+    scheduler.addTask("schedulerStats", 10000, 5, [&]()
+                      {
+                          scheduler.logStats();
+                          logDeferred("userControl", std::format("Drive motor writes/s: {} | Current headroom: {:.1f} A", drive.getDeviceWritesPerSecond(), drive.getCurrentHeadroomAmps()), Log::Level::Debug);
+                          scheduler.resetStats();
+                      });
+
+    scheduler.run([]()
+                  { return Competition.isEnabled(); });
+
+    if (recorder && recorder->save(replayFileName))
+    {
+        logHandler("userControl", std::format("Saved {} recorded ticks to {}.", recorder->getSampleCount(), replayFileName), Log::Level::Info);
+    }
 
-            // Apply the calculated voltages to the motors
-            LeftDriveSmart.spin(vex::directionType::fwd, forwardVolts + turnVolts, vex::voltageUnits::volt);
-            RightDriveSmart.spin(vex::directionType::fwd, forwardVolts - turnVolts, vex::voltageUnits::volt);
-        }
-        vex::this_thread::sleep_for(ConfigManager.getCtrlr1PollingRate());
+    // Shown in diagnostic mode on the next boot
+    for (const std::string &line : Metrics.reportLines())
+    {
+        logHandler("sessionMetrics", line, Log::Level::Info);
     }
+    Metrics.save(SessionMetrics::reportFileName);
 }
\ No newline at end of file
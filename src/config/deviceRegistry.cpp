@@ -0,0 +1,143 @@
+#include "vex.h"
+
+DeviceRegistry Devices;
+
+static_assert(static_cast<std::size_t>(configManager::Device::RearRightMotor) < 4, "Drive motors must come first in configManager::Device");
+
+/**
+ * @brief Constructs every device from the parsed config. Later calls do nothing.
+ *
+ * Config ports are numbered as on the brain (1-21); vex device indices start at 0.
+ */
+void DeviceRegistry::begin()
+{
+    beginMutex.lock();
+    if (!ready.load(std::memory_order_relaxed))
+    {
+        for (Device device : driveMotors)
+        {
+            const configManager::DeviceConfig config = ConfigManager.getDeviceConfig(device);
+            motors[static_cast<std::size_t>(device)].emplace(config.port - 1, config.gearSetting, config.reversed).setStopping(vex::brakeType::coast);
+        }
+        inertialSensor.emplace(ConfigManager.getDeviceConfig(Device::Inertial).port - 1);
+        bumperSwitch.emplace(*ConfigManager.getTriPort(Device::RearBumper));
+        ready.store(true, std::memory_order_release);
+    }
+    beginMutex.unlock();
+}
+
+// Devices used before begin() are built from whatever config is loaded at that point.
+void DeviceRegistry::ensureReady()
+{
+    if (!isReady())
+    {
+        logHandler("DeviceRegistry", "Device used before the config was loaded.", Log::Level::Warn, 2);
+        begin();
+    }
+}
+
+vex::motor &DeviceRegistry::motor(Device device)
+{
+    ensureReady();
+    std::size_t index = static_cast<std::size_t>(device);
+    if (index >= motorCount)
+    {
+        logHandler("DeviceRegistry::motor", std::format("{} is not a motor", configManager::deviceName(device)), Log::Level::Error, 3);
+        index = 0;
+    }
+    return *motors[index].get();
+}
+
+vex::inertial &DeviceRegistry::inertial()
+{
+    ensureReady();
+    return *inertialSensor;
+}
+
+vex::bumper &DeviceRegistry::rearBumper()
+{
+    ensureReady();
+    return *bumperSwitch;
+}
+
+std::array<configManager::Device, 2> DeviceRegistry::sideMotors(Side side)
+{
+    if (side == Side::Left)
+    {
+        return {Device::FrontLeftMotor, Device::RearLeftMotor};
+    }
+    return {Device::FrontRightMotor, Device::RearRightMotor};
+}
+
+/**
+ * @brief Average velocity of one side's motors, as motor_group::velocity reported it.
+ */
+double DeviceRegistry::sideVelocityRpm(Side side)
+{
+    const auto [front, rear] = sideMotors(side);
+    return (motor(front).velocity(vex::velocityUnits::rpm) + motor(rear).velocity(vex::velocityUnits::rpm)) / 2;
+}
+
+/**
+ * @brief Average position of one side's motors, as motor_group::position reported it.
+ */
+double DeviceRegistry::sidePositionDeg(Side side)
+{
+    const auto [front, rear] = sideMotors(side);
+    return (motor(front).position(vex::rotationUnits::deg) + motor(rear).position(vex::rotationUnits::deg)) / 2;
+}
+
+void DeviceRegistry::spinSide(Side side, double volts)
+{
+    for (Device device : sideMotors(side))
+    {
+        motor(device).spin(vex::directionType::fwd, volts, vex::voltageUnits::volt);
+    }
+}
+
+void DeviceRegistry::stopSide(Side side, vex::brakeType mode)
+{
+    for (Device device : sideMotors(side))
+    {
+        motor(device).stop(mode);
+    }
+}
+
+/**
+ * @brief Moves a drive motor to another smart port without restarting anything.
+ *
+ * The new vex::motor is published in one atomic store; the drive picks it up at its next tick
+ * through getGeneration(). The old port is stopped. Called by the config watcher when a port
+ * changes in the config file, see configManager::rebindMovedMotors(); call from one thread at a
+ * time.
+ *
+ * @param port Smart port as labelled on the brain (1-21).
+ * @return false if the device is not a motor, the port is invalid, or the same motor was moved
+ *         less than minRebindIntervalMs ago (its previous object may still be in use).
+ */
+bool DeviceRegistry::rebindMotor(Device device, int port)
+{
+    const std::size_t index = static_cast<std::size_t>(device);
+    if (index >= motorCount || port < 1 || port > 21)
+    {
+        logHandler("DeviceRegistry::rebindMotor", std::format("Cannot move {} to port {}", configManager::deviceName(device), port), Log::Level::Warn, 3);
+        return false;
+    }
+    ensureReady();
+
+    const std::uint32_t nowMs = vex::timer::system();
+    if (lastRebindMs[index] != 0 && nowMs - lastRebindMs[index] < minRebindIntervalMs)
+    {
+        return false;
+    }
+
+    vex::motor *previous = motors[index].get();
+    const configManager::DeviceConfig config = ConfigManager.getDeviceConfig(device);
+    motors[index].emplace(port - 1, config.gearSetting, config.reversed).setStopping(vex::brakeType::coast);
+    generation.fetch_add(1, std::memory_order_release);
+    previous->stop(vex::brakeType::coast);
+    lastRebindMs[index] = nowMs;
+
+    logHandler("DeviceRegistry::rebindMotor", std::format("{} moved to port {}", configManager::deviceName(device), port), Log::Level::Info, 3);
+    return true;
+}
@@ -0,0 +1,268 @@
+#include "vex.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <fstream>
+
+static std::string_view trimStoreText(std::string_view text)
+{
+    const std::size_t first = text.find_first_not_of(" \t\r");
+    if (first == std::string_view::npos)
+    {
+        return {};
+    }
+    return text.substr(first, text.find_last_not_of(" \t\r") - first + 1);
+}
+
+// Keys in the file are matched case-insensitively, like the parser does.
+static bool storeKeyEquals(std::string_view a, std::string_view b)
+{
+    if (a.size() != b.size())
+    {
+        return false;
+    }
+    for (std::size_t i = 0; i < a.size(); ++i)
+    {
+        if (std::toupper(static_cast<unsigned char>(a[i])) != std::toupper(static_cast<unsigned char>(b[i])))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Reads all of `name` into `text`. false if the file cannot be opened or a read fails before its end.
+static bool readStoreFile(const std::string &name, std::string &text)
+{
+    std::ifstream in(name, std::ios::binary);
+    if (!in)
+    {
+        return false;
+    }
+    text.clear();
+    char chunk[512];
+    while (in.read(chunk, sizeof(chunk)) || in.gcount() > 0)
+    {
+        text.append(chunk, static_cast<std::size_t>(in.gcount()));
+    }
+    return in.eof() && !in.bad();
+}
+
+ConfigFileStore::ConfigFileStore(std::string_view fileName)
+    : fileName(fileName), tempFileName(std::string(fileName) + ".tmp")
+{
+}
+
+/**
+ * @brief Stages `value` for `key`, replacing a value staged earlier for the same key.
+ *
+ * @param nowMs Current time; restarts the debounce.
+ */
+void ConfigFileStore::set(std::string_view key, std::string_view value, std::uint32_t nowMs)
+{
+    stagedMutex.lock();
+    auto it = std::find_if(staged.begin(), staged.end(), [&](const Edit &edit)
+                           { return edit.key == key; });
+    if (it == staged.end())
+    {
+        staged.push_back(Edit{std::string(key), std::string(value)});
+    }
+    else
+    {
+        it->value = value;
+    }
+    lastSetMs = nowMs;
+    stagedMutex.unlock();
+}
+
+/**
+ * @brief Whether values are staged and none was staged for debounceMs.
+ */
+bool ConfigFileStore::isDue(std::uint32_t nowMs)
+{
+    stagedMutex.lock();
+    const bool due = !staged.empty() && nowMs - lastSetMs >= debounceMs;
+    stagedMutex.unlock();
+    return due;
+}
+
+/**
+ * @brief Returns `text` with each edit applied to its top-level line.
+ *
+ * The first top-level line of a key gets the new value in place; later lines of the same key,
+ * such as the DRIVEMODE lines older firmware appended on every change, are dropped. A key with
+ * no line is appended at the end. Lines inside device blocks and comments are never touched.
+ */
+std::string ConfigFileStore::applyEdits(std::string_view text, std::span<const Edit> edits)
+{
+    std::string result;
+    result.reserve(text.size() + 64);
+    std::vector<bool> written(edits.size(), false);
+    std::size_t depth = 0;
+
+    std::size_t lineStart = 0;
+    while (lineStart < text.size())
+    {
+        std::size_t lineEnd = text.find('\n', lineStart);
+        const bool lastLine = lineEnd == std::string_view::npos;
+        if (lastLine)
+        {
+            lineEnd = text.size();
+        }
+        const std::string_view rawLine = text.substr(lineStart, lineEnd - lineStart);
+        const std::string_view line = trimStoreText(rawLine);
+        lineStart = lineEnd + 1;
+
+        std::size_t editIndex = edits.size();
+        const bool comment = line.empty() || line[0] == ';' || line[0] == '#';
+        if (!comment)
+        {
+            if (line == "}")
+            {
+                depth -= depth > 0 ? 1 : 0;
+            }
+            else if (line.back() == '{')
+            {
+                ++depth;
+            }
+            else if (depth == 0 && line.find('=') != std::string_view::npos)
+            {
+                const std::string_view key = trimStoreText(line.substr(0, line.find('=')));
+                for (std::size_t i = 0; i < edits.size(); ++i)
+                {
+                    if (storeKeyEquals(edits[i].key, key))
+                    {
+                        editIndex = i;
+                    }
+                }
+            }
+        }
+
+        if (editIndex == edits.size())
+        {
+            result.append(rawLine);
+        }
+        else if (!written[editIndex])
+        {
+            // Keep the line's indentation and spelling of the key
+            result.append(rawLine.substr(0, rawLine.find('=') + 1));
+            result.append(edits[editIndex].value);
+            if (!rawLine.empty() && rawLine.back() == '\r')
+            {
+                result.push_back('\r');
+            }
+            written[editIndex] = true;
+        }
+        else
+        {
+            continue; // A stale duplicate: drop the line and its newline
+        }
+        if (!lastLine)
+        {
+            result.push_back('\n');
+        }
+    }
+
+    for (std::size_t i = 0; i < edits.size(); ++i)
+    {
+        if (!written[i])
+        {
+            if (!result.empty() && result.back() != '\n')
+            {
+                result.push_back('\n');
+            }
+            result.append(edits[i].key).append("=").append(edits[i].value).append("\n");
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Writes every staged value to the config file in one rewrite.
+ *
+ * Blocks on the SD card; it runs on the config watcher thread. Values that could not be
+ * written stay staged for the next flush.
+ *
+ * @param writtenText Set to the new file contents, so the watcher does not reload its own write.
+ * @return true if the file was rewritten.
+ */
+bool ConfigFileStore::flush(std::string &writtenText)
+{
+    stagedMutex.lock();
+    std::vector<Edit> edits;
+    edits.swap(staged);
+    stagedMutex.unlock();
+    if (edits.empty())
+    {
+        return false;
+    }
+
+    // Without the whole current file the rewrite would keep only the staged keys.
+    std::string text;
+    const bool read = readStoreFile(fileName, text);
+    bool ok = false;
+    if (read)
+    {
+        writtenText = applyEdits(text, edits);
+        ok = writtenText == text;
+    }
+    if (read && !ok)
+    {
+        std::ofstream out(tempFileName, std::ios::binary | std::ios::trunc);
+        out.write(writtenText.data(), static_cast<std::streamsize>(writtenText.size()));
+        out.close();
+        // FAT cannot rename over an existing file; recover() finishes the swap if power is lost
+        // between the remove and the rename.
+        ok = out && (std::rename(tempFileName.c_str(), fileName.c_str()) == 0 ||
+                     (std::remove(fileName.c_str()) == 0 && std::rename(tempFileName.c_str(), fileName.c_str()) == 0));
+    }
+    if (!ok)
+    {
+        stagedMutex.lock();
+        for (Edit &edit : edits)
+        {
+            if (std::none_of(staged.begin(), staged.end(), [&](const Edit &newer)
+                             { return newer.key == edit.key; }))
+            {
+                staged.push_back(std::move(edit));
+            }
+        }
+        stagedMutex.unlock();
+        logHandler("configFileStore", read ? "Could not save settings to the config file." : "Could not read the config file; settings not saved yet.", Log::Level::Warn, 3);
+    }
+    return ok;
+}
+
+/**
+ * @brief Finishes or discards a rewrite cut off by power loss. Call before reading the file.
+ *
+ * A complete temporary file without a config file is the interrupted swap; a temporary file
+ * next to a readable config file may be partial and is removed. If either file cannot be read
+ * both are left as they are, so neither copy is lost on a bad read.
+ */
+void ConfigFileStore::recover()
+{
+    if (!Brain.SDcard.exists(tempFileName.c_str()))
+    {
+        return;
+    }
+    if (Brain.SDcard.exists(fileName.c_str()))
+    {
+        std::string text;
+        if (!readStoreFile(fileName, text))
+        {
+            logHandler("configFileStore", "Could not read the config file; keeping the interrupted save.", Log::Level::Warn, 3);
+            return;
+        }
+        std::remove(tempFileName.c_str());
+        return;
+    }
+    std::string tempText;
+    if (!readStoreFile(tempFileName, tempText))
+    {
+        logHandler("configFileStore", "Could not read the interrupted save; config file not restored.", Log::Level::Warn, 3);
+        return;
+    }
+    std::rename(tempFileName.c_str(), fileName.c_str());
+    logHandler("configFileStore", "Restored config file from an interrupted save.", Log::Level::Info);
+}
@@ -1,4 +1,5 @@
 #include "vex.h"
+#include <cstdlib>
 #include <fstream>
 
 std::array<ControllerButtonInfo, 12> createControllerButtonArray(const vex::controller &controller)
@@ -25,48 +26,49 @@ std::array<ControllerButtonInfo, 12> getControllerButtonArray(const vex::control
 
 configManager ConfigManager("config.cfg", "maintenance.txt");
 
+// The two files the maintenance journal alternates between. maintenanceFileName is only read, to
+// carry over the values of a brain that has not written a journal yet.
+static const char *maintenanceJournalFileNames[2] = {"maint_a.jnl", "maint_b.jnl"};
+
 // Constructor
 configManager::configManager(const std::string &configFileName, const std::string &maintenanceFileName)
-    : driveMode(DriveMode::SplitArcade),
-      configFileName(configFileName),
-      maintenanceFileName(maintenanceFileName),
-      maxOptionSize(4),
-      logToFile(true),
-      POLLINGRATE(5),
-      PRINTLOGO(true),
-      CTRLR1POLLINGRATE(25),
-      logLevel(Log::Level::Info),
-      vsyncGif(true),
-      odometer(0),
-      lastService(0),
-      serviceInterval(1000)
+    : configManager(configFileName, ParseOnly{})
 {
+    this->maintenanceFileName = maintenanceFileName;
+    interactive = true;
     readMaintenanceData();
-    serviceWarningLogged = false;
+}
 
-    // Initialize triPorts with pointers to Brain.ThreeWirePort
-    triPorts["A"] = &Brain.ThreeWirePort.A;
-    triPorts["B"] = &Brain.ThreeWirePort.B;
-    triPorts["C"] = &Brain.ThreeWirePort.C;
-    triPorts["D"] = &Brain.ThreeWirePort.D;
-    triPorts["E"] = &Brain.ThreeWirePort.E;
-    triPorts["F"] = &Brain.ThreeWirePort.F;
-    triPorts["G"] = &Brain.ThreeWirePort.G;
-    triPorts["H"] = &Brain.ThreeWirePort.H;
+/**
+ * @brief Builds a configManager holding the schema defaults, for parsing a config text into.
+ *
+ * The config watcher parses each changed file into one of these. Unlike the full constructor it
+ * never reads the maintenance journal, which the journal thread may be writing at the same time,
+ * and it never prompts.
+ */
+configManager::configManager(const std::string &configFileName, ParseOnly)
+    : configFileName(configFileName),
+      configStore(configFileName),
+      maintenanceJournal(maintenanceJournalFileNames[0], maintenanceJournalFileNames[1]),
+      odometer(0),
+      lastService(0),
+      serviceInterval(1000),
+      serviceWarningLogged(false),
+      interactive(false)
+{
+    applyDefaults();
+    publishLiveSettings(*this);
 }
 
-vex::triport::port *configManager::getTriPort(const std::string &portName)
+/**
+ * @brief Returns the brain's three-wire port a device is configured on.
+ */
+vex::triport::port *configManager::getTriPort(Device device) const
 {
-    auto it = triPorts.find(portName);
-    if (it != triPorts.end())
-    {
-        return it->second;
-    }
-    else
-    {
-        resetOrInitializeConfig("Triport not found: " + portName);
-        return it->second;
-    }
+    vex::triport::port *const ports[] = {
+        &Brain.ThreeWirePort.A, &Brain.ThreeWirePort.B, &Brain.ThreeWirePort.C, &Brain.ThreeWirePort.D,
+        &Brain.ThreeWirePort.E, &Brain.ThreeWirePort.F, &Brain.ThreeWirePort.G, &Brain.ThreeWirePort.H};
+    return ports[std::clamp(getDeviceConfig(device).port, 0, 7)];
 }
 
 // New validation functions for strings
@@ -125,6 +127,32 @@ void configManager::setLogLevel(const Log::Level &value)
     logLevel = value;
 }
 
+void configManager::setInputExpo(double value)
+{
+    if (value < 0 || value > 1)
+    {
+        logHandler("configManager::setInputExpo", "INPUTEXPO must be between 0 and 1. Using linear input.", Log::Level::Warn, 3);
+        value = 0;
+    }
+    inputExpo = value;
+}
+
+void configManager::setSlewRate(double value)
+{
+    slewRate = value < 0 ? 0 : value;
+}
+
+void configManager::setAebDistancePort(int value)
+{
+    aebDistancePort = (value >= 1 && value <= 21) ? value : 0;
+}
+
+void configManager::setDriveCurrentBudget(double value)
+{
+    // Below one motor's worth the drive cannot move; above four stalled motors there is nothing to limit.
+    driveCurrentBudget = std::clamp(value, 2.5, 10.0);
+}
+
 void configManager::setTeamNumber(const std::string &value)
 {
     if (!validateStringNotEmpty(value))
@@ -180,73 +208,24 @@ void configManager::setDriverGifPath(const std::string &value)
     driverGifPath = value;
 }
 
-int configManager::getMotorPort(const std::string &motorName)
-{
-    auto it = motorPorts.find(motorName);
-    if (it != motorPorts.end())
-    {
-        return it->second;
-    }
-    else
-    {
-        resetOrInitializeConfig("Motor port not found: " + motorName);
-        return it->second;
-    }
-}
-
-std::string configManager::getGearRatio(const std::string &motorName) const
-{
-    auto it = motorGearRatios.find(motorName);
-    if (it != motorGearRatios.end())
-    {
-        return it->second;
-    }
-    else
-    {
-        logHandler("configManager::getGearRatio", "Motor gear ratio not found for: " + motorName + ". Using default ratio 18_1.", Log::Level::Warn, 3);
-        return "18_1"; // Default ratio
-    }
-}
-
-bool configManager::getMotorReversed(const std::string &motorName) const
-{
-    auto it = motorReversed.find(motorName);
-    if (it != motorReversed.end())
-    {
-        return it->second;
-    }
-    else
-    {
-        logHandler("configManager::getMotorReversed", "Motor reversed state not found for: " + motorName + ". Using default state false.", Log::Level::Warn, 3);
-        return false; // Default reversed state
-    }
-}
-
-vex::gearSetting configManager::getGearSetting(const std::string &ratio) const
+/**
+ * @brief Adds the drive travel since the last call to the odometer and queues it for the
+ *        maintenance journal.
+ *
+ * After a drive motor was moved to another port the call only takes a new baseline, so the
+ * jump between the old and the new motor's encoder is not counted as travel.
+ *
+ * @param averagePosition Average drive motor position in degrees, as read from the motors.
+ */
+void configManager::updateOdometer(const int &averagePosition)
 {
-    if (ratio == "6_1")
-    {
-        return vex::gearSetting::ratio6_1;
-    }
-    else if (ratio == "18_1")
-    {
-        return vex::gearSetting::ratio18_1;
-    }
-    else if (ratio == "36_1")
+    if (odometerRebaseline.exchange(false, std::memory_order_acq_rel))
     {
-        return vex::gearSetting::ratio36_1;
+        lastDrivePosition = averagePosition;
     }
-    else
-    {
-        logHandler("configManager::getGearSetting", "Invalid gear ratio: " + ratio + ". Using default ratio 18_1.", Log::Level::Warn, 3);
-        return vex::gearSetting::ratio18_1; // Default
-    }
-}
-
-void configManager::updateOdometer(const int &averagePosition)
-{
-    odometer += averagePosition;
-    // Removed unused writeThreshold and accumulatedDistance.
+    odometer += std::abs(averagePosition - lastDrivePosition);
+    lastDrivePosition = averagePosition;
+    writeMaintenanceData();
 
     if (odometer - lastService >= serviceInterval && !serviceWarningLogged)
     {
@@ -265,6 +244,7 @@ void configManager::checkServiceInterval()
     {
         logHandler("Service", "Service needed! Distance: " + std::to_string(odometer), Log::Level::Warn, 5);
         lastService = odometer;
+        writeMaintenanceData();
     }
 }
 
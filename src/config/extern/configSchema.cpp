@@ -0,0 +1,608 @@
+#include "vex.h"
+#include <algorithm>
+#include <ostream>
+
+using ConfigApply = void (*)(configManager &, const ConfigValue &);
+using ConfigRead = void (*)(const configManager &, ConfigValue &);
+
+static constexpr ConfigField boolField(std::string_view key, std::string_view defaultValue, ConfigApply apply, ConfigRead read)
+{
+    return {key, ConfigValueType::Bool, defaultValue, 0, 0, {}, apply, read, false};
+}
+
+static constexpr ConfigField integerField(std::string_view key, std::string_view defaultValue, double min, double max, ConfigApply apply, ConfigRead read)
+{
+    return {key, ConfigValueType::Integer, defaultValue, min, max, {}, apply, read, false};
+}
+
+static constexpr ConfigField numberField(std::string_view key, std::string_view defaultValue, double min, double max, ConfigApply apply, ConfigRead read)
+{
+    return {key, ConfigValueType::Number, defaultValue, min, max, {}, apply, read, false};
+}
+
+static constexpr ConfigField textField(std::string_view key, std::string_view defaultValue, std::size_t maxLength, ConfigApply apply, ConfigRead read)
+{
+    return {key, ConfigValueType::Text, defaultValue, 1, static_cast<double>(maxLength), {}, apply, read, false};
+}
+
+static constexpr ConfigField choiceField(std::string_view key, std::string_view defaultValue, std::span<const ConfigChoice> choices, ConfigApply apply, ConfigRead read)
+{
+    return {key, ConfigValueType::Choice, defaultValue, 0, 0, choices, apply, read, false};
+}
+
+static constexpr ConfigField aliasOf(std::string_view key, ConfigField field)
+{
+    field.key = key;
+    field.alias = true;
+    return field;
+}
+
+static constexpr ConfigChoice configTypeChoices[] = {
+    {"Brain", static_cast<int>(configManager::ConfigType::Brain)},
+    {"Controller", static_cast<int>(configManager::ConfigType::Controller)}};
+
+static constexpr ConfigChoice driveModeChoices[] = {
+    {"LeftArcade", static_cast<int>(configManager::DriveMode::LeftArcade)},
+    {"RightArcade", static_cast<int>(configManager::DriveMode::RightArcade)},
+    {"SplitArcade", static_cast<int>(configManager::DriveMode::SplitArcade)},
+    {"Tank", static_cast<int>(configManager::DriveMode::Tank)},
+    {"Arcade", static_cast<int>(configManager::DriveMode::LeftArcade)},
+    {"Split", static_cast<int>(configManager::DriveMode::SplitArcade)}};
+
+static constexpr ConfigChoice logLevelChoices[] = {
+    {"Trace", static_cast<int>(Log::Level::Trace)},
+    {"Debug", static_cast<int>(Log::Level::Debug)},
+    {"Info", static_cast<int>(Log::Level::Info)},
+    {"Warn", static_cast<int>(Log::Level::Warn)},
+    {"Error", static_cast<int>(Log::Level::Error)},
+    {"Fatal", static_cast<int>(Log::Level::Fatal)}};
+
+static constexpr ConfigChoice driveOutputChoices[] = {
+    {"Voltage", static_cast<int>(configManager::DriveOutput::Voltage)},
+    {"Velocity", static_cast<int>(configManager::DriveOutput::Velocity)}};
+
+static constexpr ConfigChoice autonModeChoices[] = {
+    {"Route", static_cast<int>(configManager::AutonMode::Route)},
+    {"Replay", static_cast<int>(configManager::AutonMode::Replay)}};
+
+static constexpr ConfigChoice drivePriorityChoices[] = {
+    {"Turn", static_cast<int>(configManager::DrivePriority::Turn)},
+    {"Forward", static_cast<int>(configManager::DrivePriority::Forward)}};
+
+static constexpr ConfigChoice gearChoices[] = {
+    {"6_1", static_cast<int>(vex::gearSetting::ratio6_1)},
+    {"18_1", static_cast<int>(vex::gearSetting::ratio18_1)},
+    {"36_1", static_cast<int>(vex::gearSetting::ratio36_1)}};
+
+/**
+ * @enum DeviceKind
+ * @brief Which fields a device block has and how its PORT is written.
+ */
+enum class DeviceKind : std::uint8_t
+{
+    Motor,    ///< PORT 1-21, GEAR_RATIO and REVERSED.
+    Inertial, ///< PORT 1-21.
+    TriPort   ///< PORT A-H.
+};
+
+/**
+ * @struct DeviceField
+ * @brief The config file name, kind and default placement of one configManager::Device.
+ */
+struct DeviceField
+{
+    std::string_view name;
+    DeviceKind kind;
+    configManager::DeviceConfig defaults;
+};
+
+// Indexed by configManager::Device.
+static constexpr std::array deviceFields = {
+    DeviceField{"FRONT_LEFT_MOTOR", DeviceKind::Motor, {1, vex::gearSetting::ratio6_1, false}},
+    DeviceField{"FRONT_RIGHT_MOTOR", DeviceKind::Motor, {10, vex::gearSetting::ratio6_1, true}},
+    DeviceField{"REAR_LEFT_MOTOR", DeviceKind::Motor, {11, vex::gearSetting::ratio6_1, false}},
+    DeviceField{"REAR_RIGHT_MOTOR", DeviceKind::Motor, {20, vex::gearSetting::ratio6_1, true}},
+    DeviceField{"INERTIAL", DeviceKind::Inertial, {3, vex::gearSetting::ratio18_1, false}},
+    DeviceField{"REAR_BUMPER", DeviceKind::TriPort, {0, vex::gearSetting::ratio18_1, false}},
+};
+static_assert(deviceFields.size() == static_cast<std::size_t>(configManager::Device::Count), "Every device needs a config name");
+
+static constexpr auto deviceIndex = buildConfigKeyIndex<16>(deviceFields, &DeviceField::name);
+static_assert(deviceIndex.found, "Device names must hash without collisions; add a seed or grow the table");
+
+/**
+ * @struct DeviceFieldName
+ * @brief The spelling of one configManager::DeviceFieldKey inside a device block.
+ */
+struct DeviceFieldName
+{
+    std::string_view name;
+    configManager::DeviceFieldKey key;
+};
+
+static constexpr std::array deviceFieldNames = {
+    DeviceFieldName{"PORT", configManager::DeviceFieldKey::Port},
+    DeviceFieldName{"GEAR_RATIO", configManager::DeviceFieldKey::GearRatio},
+    DeviceFieldName{"REVERSED", configManager::DeviceFieldKey::Reversed},
+};
+static_assert(deviceFieldNames.size() == static_cast<std::size_t>(configManager::DeviceFieldKey::Count), "Every device field needs a name");
+
+static constexpr auto deviceFieldIndex = buildConfigKeyIndex<8>(deviceFieldNames, &DeviceFieldName::name);
+static_assert(deviceFieldIndex.found, "Device fields must hash without collisions; add a seed or grow the table");
+
+// Sections a device block may appear in. The device name alone decides what the device is.
+static constexpr std::string_view deviceSections[] = {"MOTOR_CONFIG", "TRIPORT_CONFIG", "INERTIAL"};
+
+/**
+ * @struct configManager::Schema
+ * @brief Every top-level config key, in the order the default config file lists them.
+ *
+ * This table is the only place a key is named: setValuesFromConfig() dispatches through it,
+ * resetOrInitializeConfig() writes it, applyDefaults() applies its defaults and the config
+ * snapshot stores and restores every setting through its read and apply functions.
+ */
+struct configManager::Schema
+{
+    static constexpr ConfigField driverGifPath = textField("DRIVERGIFPATH", "drive.gif", 20, [](configManager &c, const ConfigValue &v)
+                                                           { c.setDriverGifPath(std::string(v.text)); },
+                                                           [](const configManager &c, ConfigValue &v)
+                                                           { v.text = c.driverGifPath; });
+
+    static constexpr std::array fields = {
+        boolField("PRINTLOGO", "true", [](configManager &c, const ConfigValue &v)
+                  { c.setPrintLogo(v.flag); },
+                  [](const configManager &c, ConfigValue &v)
+                  { v.flag = c.PRINTLOGO; }),
+        boolField("LOGTOFILE", "true", [](configManager &c, const ConfigValue &v)
+                  { c.setLogToFile(v.flag); },
+                  [](const configManager &c, ConfigValue &v)
+                  { v.flag = c.logToFile; }),
+        choiceField("LOGLEVEL", "Info", logLevelChoices, [](configManager &c, const ConfigValue &v)
+                    { c.setLogLevel(static_cast<Log::Level>(v.choice)); },
+                    [](const configManager &c, ConfigValue &v)
+                    { v.choice = static_cast<int>(c.logLevel); }),
+        integerField("MAXOPTIONSSIZE", "4", 4, 12, [](configManager &c, const ConfigValue &v)
+                     { c.setMaxOptionSize(static_cast<std::size_t>(v.integer)); },
+                     [](const configManager &c, ConfigValue &v)
+                     { v.integer = static_cast<long long>(c.maxOptionSize); }),
+        integerField("POLLINGRATE", "5", 1, 100, [](configManager &c, const ConfigValue &v)
+                     { c.setPollingRate(static_cast<std::size_t>(v.integer)); },
+                     [](const configManager &c, ConfigValue &v)
+                     { v.integer = static_cast<long long>(c.POLLINGRATE); }),
+        integerField("CTRLR1POLLINGRATE", "25", 5, 100, [](configManager &c, const ConfigValue &v)
+                     { c.setCtrlr1PollingRate(static_cast<std::size_t>(v.integer)); },
+                     [](const configManager &c, ConfigValue &v)
+                     { v.integer = static_cast<long long>(c.CTRLR1POLLINGRATE); }),
+        choiceField("CONFIGTYPE", "Controller", configTypeChoices, [](configManager &c, const ConfigValue &v)
+                    { c.configType = static_cast<ConfigType>(v.choice); },
+                    [](const configManager &c, ConfigValue &v)
+                    { v.choice = static_cast<int>(c.configType); }),
+        textField("TEAMNUMBER", "12", 2, [](configManager &c, const ConfigValue &v)
+                  { c.setTeamNumber(std::string(v.text)); },
+                  [](const configManager &c, ConfigValue &v)
+                  { v.text = c.teamNumber; }),
+        textField("LOADINGGIFPATH", "loading.gif", 20, [](configManager &c, const ConfigValue &v)
+                  { c.setLoadingGifPath(std::string(v.text)); },
+                  [](const configManager &c, ConfigValue &v)
+                  { v.text = c.loadingGifPath; }),
+        textField("AUTOGIFPATH", "auto.gif", 20, [](configManager &c, const ConfigValue &v)
+                  { c.setAutoGifPath(std::string(v.text)); },
+                  [](const configManager &c, ConfigValue &v)
+                  { v.text = c.autoGifPath; }),
+        driverGifPath,
+        aliasOf("DRIVEGIFPATH", driverGifPath), // Written by older default configs
+        boolField("VSYNCGIF", "true", [](configManager &c, const ConfigValue &v)
+                  { c.SetVsyncGif(v.flag); },
+                  [](const configManager &c, ConfigValue &v)
+                  { v.flag = c.vsyncGif; }),
+        // Assigned directly: setDriveMode() would stage a write of the value just read.
+        choiceField("DRIVEMODE", "SplitArcade", driveModeChoices, [](configManager &c, const ConfigValue &v)
+                    { c.driveMode = static_cast<DriveMode>(v.choice); },
+                    [](const configManager &c, ConfigValue &v)
+                    { v.choice = static_cast<int>(c.driveMode); }),
+        integerField("LEFTDEADZONE", "10", 0, 100, [](configManager &c, const ConfigValue &v)
+                     { c.setLeftDeadzone(static_cast<int>(v.integer)); },
+                     [](const configManager &c, ConfigValue &v)
+                     { v.integer = c.leftDeadzone; }),
+        integerField("RIGHTDEADZONE", "10", 0, 100, [](configManager &c, const ConfigValue &v)
+                     { c.setRightDeadzone(static_cast<int>(v.integer)); },
+                     [](const configManager &c, ConfigValue &v)
+                     { v.integer = c.rightDeadzone; }),
+        numberField("INPUTEXPO", "0", 0, 1, [](configManager &c, const ConfigValue &v)
+                    { c.setInputExpo(v.number); },
+                    [](const configManager &c, ConfigValue &v)
+                    { v.number = c.inputExpo; }),
+        numberField("SLEWRATE", "0", 0, 1000, [](configManager &c, const ConfigValue &v)
+                    { c.setSlewRate(v.number); },
+                    [](const configManager &c, ConfigValue &v)
+                    { v.number = c.slewRate; }),
+        choiceField("DRIVEOUTPUT", "Voltage", driveOutputChoices, [](configManager &c, const ConfigValue &v)
+                    { c.setDriveOutput(static_cast<DriveOutput>(v.choice)); },
+                    [](const configManager &c, ConfigValue &v)
+                    { v.choice = static_cast<int>(c.driveOutput); }),
+        numberField("VELKS", "0.3", 0, 12, [](configManager &c, const ConfigValue &v)
+                    { c.velocityGains.kS = v.number; },
+                    [](const configManager &c, ConfigValue &v)
+                    { v.number = c.velocityGains.kS; }),
+        numberField("VELKV", "0.02", 0, 1, [](configManager &c, const ConfigValue &v)
+                    { c.velocityGains.kV = v.number; },
+                    [](const configManager &c, ConfigValue &v)
+                    { v.number = c.velocityGains.kV; }),
+        numberField("VELKA", "0.002", 0, 1, [](configManager &c, const ConfigValue &v)
+                    { c.velocityGains.kA = v.number; },
+                    [](const configManager &c, ConfigValue &v)
+                    { v.number = c.velocityGains.kA; }),
+        numberField("VELKP", "0.04", 0, 1, [](configManager &c, const ConfigValue &v)
+                    { c.velocityGains.kP = v.number; },
+                    [](const configManager &c, ConfigValue &v)
+                    { v.number = c.velocityGains.kP; }),
+        numberField("VELKI", "0.02", 0, 1, [](configManager &c, const ConfigValue &v)
+                    { c.velocityGains.kI = v.number; },
+                    [](const configManager &c, ConfigValue &v)
+                    { v.number = c.velocityGains.kI; }),
+        choiceField("AUTONMODE", "Route", autonModeChoices, [](configManager &c, const ConfigValue &v)
+                    { c.setAutonMode(static_cast<AutonMode>(v.choice)); },
+                    [](const configManager &c, ConfigValue &v)
+                    { v.choice = static_cast<int>(c.autonMode); }),
+        boolField("RECORDINPUT", "false", [](configManager &c, const ConfigValue &v)
+                  { c.setRecordInput(v.flag); },
+                  [](const configManager &c, ConfigValue &v)
+                  { v.flag = c.recordInput; }),
+        integerField("AEBDISTANCEPORT", "0", 0, 21, [](configManager &c, const ConfigValue &v)
+                     { c.setAebDistancePort(static_cast<int>(v.integer)); },
+                     [](const configManager &c, ConfigValue &v)
+                     { v.integer = c.aebDistancePort; }),
+        boolField("MENUSTOPSDRIVE", "true", [](configManager &c, const ConfigValue &v)
+                  { c.setMenuStopsDrive(v.flag); },
+                  [](const configManager &c, ConfigValue &v)
+                  { v.flag = c.menuStopsDrive; }),
+        boolField("PREFLIGHTPULSE", "true", [](configManager &c, const ConfigValue &v)
+                  { c.setPreflightPulse(v.flag); },
+                  [](const configManager &c, ConfigValue &v)
+                  { v.flag = c.preflightPulse; }),
+        numberField("DRIVECURRENTBUDGET", "8", 2.5, 10, [](configManager &c, const ConfigValue &v)
+                    { c.setDriveCurrentBudget(v.number); },
+                    [](const configManager &c, ConfigValue &v)
+                    { v.number = c.driveCurrentBudget; }),
+        choiceField("DRIVEPRIORITY", "Turn", drivePriorityChoices, [](configManager &c, const ConfigValue &v)
+                    { c.setDrivePriority(static_cast<DrivePriority>(v.choice)); },
+                    [](const configManager &c, ConfigValue &v)
+                    { v.choice = static_cast<int>(c.drivePriority); }),
+        ConfigField{"VERSION", ConfigValueType::Version, {}, 0, 0, {}, [](configManager &, const ConfigValue &v)
+                    {
+                        if (v.text != Version)
+                        {
+                            logHandler("setValuesFromConfig", std::format("Version mismatch with Config file ({}) and code version ({}). Potential problems may occur.", v.text, Version), Log::Level::Warn, 4);
+                        }
+                    },
+                    nullptr, false},
+    };
+
+    static constexpr auto index = buildConfigKeyIndex<128>(fields, &ConfigField::key);
+    static_assert(index.found, "Config keys must hash without collisions; add a seed or grow the table");
+    static_assert(std::ranges::all_of(fields, [](const ConfigField &field)
+                                      { return field.read != nullptr || field.type == ConfigValueType::Version; }),
+                  "Every setting needs a read function: the snapshot and writeSettings() are built from it");
+};
+
+/**
+ * @brief Every top-level key, in the order the default config file lists them.
+ */
+std::span<const ConfigField> configManager::getSchema()
+{
+    return Schema::fields;
+}
+
+/**
+ * @brief Finds the schema row for a top-level key in O(1).
+ *
+ * @return The row, or nullptr if the key is not known.
+ */
+const ConfigField *configManager::findConfigField(std::string_view key)
+{
+    return findConfigKey(Schema::index, Schema::fields, &ConfigField::key, key);
+}
+
+// Looks up the value of `name` among a field's accepted spellings, ignoring case.
+static bool findConfigChoice(std::span<const ConfigChoice> choices, std::string_view name, int &value)
+{
+    for (const ConfigChoice &choice : choices)
+    {
+        if (configKeyEquals(choice.name, name))
+        {
+            value = choice.value;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief The name written to the file for `value` of the Choice field `key`, e.g. "Tank" for
+ *        DRIVEMODE. Empty if the key or value is unknown.
+ */
+std::string_view configManager::configChoiceName(std::string_view key, int value)
+{
+    const ConfigField *field = findConfigField(key);
+    if (field == nullptr)
+    {
+        return {};
+    }
+    for (const ConfigChoice &choice : field->choices)
+    {
+        if (choice.value == value)
+        {
+            return choice.name;
+        }
+    }
+    return {};
+}
+
+/**
+ * @brief Parses `text` as the type of `field` and checks it against the field's range.
+ *
+ * Errors are logged with the config line and column and counted in parseErrors. A number
+ * outside its range is clamped into it; any other invalid value is rejected and the setting
+ * keeps its current value.
+ *
+ * @return false if the value must not be applied.
+ */
+bool configManager::parseConfigValue(const ConfigField &field, std::string_view text, ConfigValue &value)
+{
+    auto outOfRange = [&](double clamped)
+    {
+        ++parseErrors;
+        logHandler("setValuesFromConfig", std::format("{} must be between {} and {}. Using {}{}", field.key, field.min, field.max, clamped, locationSuffix()), Log::Level::Warn, 3);
+    };
+
+    // stringToBool() and stringToNumber() count their own errors; a value that did not parse is not applied.
+    const std::size_t errorsBefore = parseErrors;
+    switch (field.type)
+    {
+    case ConfigValueType::Bool:
+        value.flag = stringToBool(text);
+        return parseErrors == errorsBefore;
+    case ConfigValueType::Integer:
+        value.integer = stringToNumber<long long>(text);
+        if (parseErrors != errorsBefore)
+        {
+            return false;
+        }
+        if (value.integer < field.min || value.integer > field.max)
+        {
+            value.integer = static_cast<long long>(std::clamp(static_cast<double>(value.integer), field.min, field.max));
+            outOfRange(static_cast<double>(value.integer));
+        }
+        return true;
+    case ConfigValueType::Number:
+        value.number = stringToNumber<double>(text);
+        if (parseErrors != errorsBefore)
+        {
+            return false;
+        }
+        if (value.number < field.min || value.number > field.max)
+        {
+            value.number = std::clamp(value.number, field.min, field.max);
+            outOfRange(value.number);
+        }
+        return true;
+    case ConfigValueType::Text:
+        if (text.empty() || text.size() > field.max)
+        {
+            ++parseErrors;
+            logHandler("setValuesFromConfig", std::format("{} must be 1 to {} characters{}", field.key, field.max, locationSuffix()), Log::Level::Warn, 3);
+            return false;
+        }
+        value.text = text;
+        return true;
+    case ConfigValueType::Choice:
+        if (!findConfigChoice(field.choices, text, value.choice))
+        {
+            ++parseErrors;
+            logHandler("setValuesFromConfig", std::format("Invalid {}: {}{}. This value will be ignored.", field.key, text, locationSuffix()), Log::Level::Warn, 3);
+            return false;
+        }
+        return true;
+    case ConfigValueType::Version:
+        value.text = text;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Looks up a top-level config key and applies its value.
+ *
+ * @return false if the key is not known.
+ */
+bool configManager::applyConfigValue(std::string_view key, std::string_view text)
+{
+    const ConfigField *field = findConfigField(key);
+    if (field == nullptr)
+    {
+        return false;
+    }
+    ConfigValue value;
+    if (parseConfigValue(*field, text, value))
+    {
+        field->apply(*this, value);
+    }
+    return true;
+}
+
+/**
+ * @brief The name a device has in the config file, e.g. FRONT_LEFT_MOTOR.
+ */
+std::string_view configManager::deviceName(Device device)
+{
+    return deviceFields[static_cast<std::size_t>(device)].name;
+}
+
+/**
+ * @brief Writes `table` as the MOTOR_CONFIG section, one block per device.
+ */
+void configManager::writeDeviceConfig(std::ostream &out, const DeviceTable &table)
+{
+    out << "    MOTOR_CONFIG {\n";
+    for (std::size_t i = 0; i < table.size(); ++i)
+    {
+        const DeviceField &field = deviceFields[i];
+        const DeviceConfig &config = table[i];
+        out << "        " << field.name << " {\n";
+        if (field.kind == DeviceKind::TriPort)
+        {
+            out << "        PORT=" << static_cast<char>('A' + config.port) << '\n';
+        }
+        else
+        {
+            out << "        PORT=" << config.port << '\n';
+        }
+        if (field.kind == DeviceKind::Motor)
+        {
+            const auto gear = std::ranges::find(gearChoices, static_cast<int>(config.gearSetting), &ConfigChoice::value);
+            out << "        GEAR_RATIO=" << (gear != std::end(gearChoices) ? gear->name : gearChoices[1].name) << '\n';
+            out << "        REVERSED=" << (config.reversed ? "true" : "false") << '\n';
+        }
+        out << "        }\n";
+    }
+    out << "    }\n";
+}
+
+/**
+ * @brief Finds which field of a device block `name` is, ignoring case, in O(1).
+ *
+ * @return false if `name` is not PORT, GEAR_RATIO or REVERSED.
+ */
+bool configManager::findDeviceField(std::string_view name, DeviceFieldKey &key)
+{
+    const DeviceFieldName *field = findConfigKey(deviceFieldIndex, deviceFieldNames, &DeviceFieldName::name, name);
+    if (field == nullptr)
+    {
+        return false;
+    }
+    key = field->key;
+    return true;
+}
+
+/**
+ * @brief Stores one device block, e.g. `FRONT_LEFT_MOTOR { PORT=1 ... }`.
+ *
+ * The name is resolved to a configManager::Device here, once, ignoring case, through the same
+ * kind of compile-time index as the top-level keys. The port and gear ratio are checked and
+ * converted into the staged table, which the next publish hands to getDeviceConfig(). A block
+ * that does not parse leaves the device where it was.
+ */
+void configManager::applyDeviceConfig(std::string_view section, std::string_view name, const DeviceBlock &block)
+{
+    const std::string_view port = block[static_cast<std::size_t>(DeviceFieldKey::Port)];
+    const std::string_view gearRatio = block[static_cast<std::size_t>(DeviceFieldKey::GearRatio)];
+    const std::string_view reversed = block[static_cast<std::size_t>(DeviceFieldKey::Reversed)];
+
+    auto deviceError = [&](std::string_view message)
+    {
+        ++parseErrors;
+        logHandler("setValuesFromConfig", std::format("{}{}", message, locationSuffix()), Log::Level::Warn, 3);
+    };
+
+    if (std::ranges::find(deviceSections, section) == std::end(deviceSections))
+    {
+        deviceError(std::format("Unknown config section {}", section));
+        return;
+    }
+    const DeviceField *field = findConfigKey(deviceIndex, deviceFields, &DeviceField::name, name);
+    if (field == nullptr)
+    {
+        deviceError(std::format("Unknown device {}", name));
+        return;
+    }
+
+    DeviceConfig config;
+    if (field->kind == DeviceKind::TriPort)
+    {
+        if (port.size() != 1 || upperAscii(port[0]) < 'A' || upperAscii(port[0]) > 'H')
+        {
+            deviceError(std::format("Invalid three-wire port {} for {}", port, field->name));
+            return;
+        }
+        config.port = upperAscii(port[0]) - 'A';
+    }
+    else
+    {
+        const std::size_t errorsBefore = parseErrors;
+        config.port = stringToNumber<int>(port);
+        if (parseErrors != errorsBefore)
+        {
+            return;
+        }
+        if (config.port < 1 || config.port > 21)
+        {
+            deviceError(std::format("Invalid smart port {} for {}", port, field->name));
+            return;
+        }
+    }
+    if (field->kind == DeviceKind::Motor)
+    {
+        int gear = 0;
+        if (!findConfigChoice(gearChoices, gearRatio, gear))
+        {
+            deviceError(std::format("Invalid gear ratio {} for {}", gearRatio, field->name));
+            return;
+        }
+        config.gearSetting = static_cast<vex::gearSetting>(gear);
+        config.reversed = !reversed.empty() && stringToBool(reversed);
+    }
+    devices[static_cast<std::size_t>(field - deviceFields.data())] = config;
+}
+
+/**
+ * @brief Writes a complete default config file: the default device placement, then every schema
+ *        key with its default value, one `KEY=VALUE` per line.
+ */
+void configManager::writeDefaultConfig(std::ostream &out)
+{
+    DeviceTable defaults;
+    for (std::size_t i = 0; i < defaults.size(); ++i)
+    {
+        defaults[i] = deviceFields[i].defaults;
+    }
+    out << "\n    # Config File:\n";
+    writeDeviceConfig(out, defaults);
+    for (const ConfigField &field : Schema::fields)
+    {
+        if (field.alias)
+        {
+            continue;
+        }
+        out << "    " << field.key << '=';
+        if (field.type == ConfigValueType::Version)
+        {
+            out << Version;
+        }
+        else
+        {
+            out << field.defaultValue;
+        }
+        out << '\n';
+    }
+}
+
+/**
+ * @brief Applies every schema default and the default device placement, as if read from a
+ *        freshly written config file.
+ */
+void configManager::applyDefaults()
+{
+    for (std::size_t i = 0; i < devices.size(); ++i)
+    {
+        devices[i] = deviceFields[i].defaults;
+    }
+    for (const ConfigField &field : Schema::fields)
+    {
+        ConfigValue value;
+        if (field.alias || field.type == ConfigValueType::Version || !parseConfigValue(field, field.defaultValue, value))
+        {
+            continue;
+        }
+        field.apply(*this, value);
+    }
+}
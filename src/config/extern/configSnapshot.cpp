@@ -0,0 +1,293 @@
+#include "vex.h"
+#include <cstring>
+#include <fstream>
+
+// Binary copy of the last cleanly parsed config, so a restart between matches skips the text parser.
+static const char *configSnapshotFileName = "config.bin";
+
+constexpr std::uint32_t snapshotMagic = 0x53474643; // "CFGS"
+constexpr std::uint32_t snapshotFormatVersion = 5;  // 5: record built from the config schema
+constexpr std::uint32_t maxSnapshotRecordSize = 4096;
+
+static std::uint64_t fnv1a(const void *data, std::size_t size, std::uint64_t hash = 1469598103934665603ull)
+{
+    const auto *bytes = static_cast<const std::uint8_t *>(data);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        hash = (hash ^ bytes[i]) * 1099511628211ull;
+    }
+    return hash;
+}
+
+/**
+ * @struct SnapshotHeader
+ * @brief Identifies the text file, firmware and record layout a snapshot was made from.
+ */
+struct SnapshotHeader
+{
+    std::uint32_t magic;
+    std::uint32_t formatVersion;
+    std::uint64_t layoutHash;  ///< Hash of the stored keys and their types, see snapshotLayoutHash().
+    std::uint64_t versionHash; ///< Hash of the firmware Version string.
+    std::uint64_t textHash;    ///< Hash of config.cfg.
+    std::uint32_t recordSize;  ///< Bytes of record that follow.
+    std::uint32_t padding;
+    std::uint64_t checksum;    ///< Hash of the record.
+};
+
+/**
+ * @struct SnapshotDevice
+ * @brief One configManager::DeviceConfig, stored at its configManager::Device index.
+ */
+struct SnapshotDevice
+{
+    std::int32_t port;
+    std::uint8_t gearSetting;
+    std::uint8_t reversed;
+    std::uint8_t padding[2];
+};
+
+// Aliases are another spelling of a stored key, and VERSION is not a setting.
+static bool storedInSnapshot(const ConfigField &field)
+{
+    return !field.alias && field.read != nullptr;
+}
+
+/**
+ * @brief Hashes the key and type of every stored setting, in schema order.
+ *
+ * The record is laid out from the schema, so adding, removing or retyping a key changes this
+ * hash and retires older snapshots without a format version bump.
+ */
+static std::uint64_t snapshotLayoutHash()
+{
+    std::uint64_t hash = fnv1a(&snapshotFormatVersion, sizeof(snapshotFormatVersion));
+    for (const ConfigField &field : configManager::getSchema())
+    {
+        if (storedInSnapshot(field))
+        {
+            hash = fnv1a(field.key.data(), field.key.size(), hash);
+            hash = fnv1a(&field.type, sizeof(field.type), hash);
+        }
+    }
+    const auto deviceCount = static_cast<std::uint32_t>(configManager::Device::Count);
+    return fnv1a(&deviceCount, sizeof(deviceCount), hash);
+}
+
+template <typename T>
+static void appendBytes(std::string &record, const T &value)
+{
+    record.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+template <typename T>
+static bool takeBytes(std::string_view &record, T &value)
+{
+    if (record.size() < sizeof(value))
+    {
+        return false;
+    }
+    std::memcpy(&value, record.data(), sizeof(value));
+    record.remove_prefix(sizeof(value));
+    return true;
+}
+
+/**
+ * @brief Appends one setting in the encoding of its type.
+ *
+ * @return false if a text value is too long for its one-byte length.
+ */
+static bool appendValue(std::string &record, const ConfigField &field, const ConfigValue &value)
+{
+    switch (field.type)
+    {
+    case ConfigValueType::Bool:
+        appendBytes(record, static_cast<std::uint8_t>(value.flag));
+        return true;
+    case ConfigValueType::Integer:
+        appendBytes(record, static_cast<std::int64_t>(value.integer));
+        return true;
+    case ConfigValueType::Number:
+        appendBytes(record, value.number);
+        return true;
+    case ConfigValueType::Choice:
+        appendBytes(record, static_cast<std::int32_t>(value.choice));
+        return true;
+    case ConfigValueType::Text:
+        if (value.text.size() > 255)
+        {
+            return false;
+        }
+        appendBytes(record, static_cast<std::uint8_t>(value.text.size()));
+        record.append(value.text);
+        return true;
+    case ConfigValueType::Version:
+        break;
+    }
+    return false;
+}
+
+/**
+ * @brief Reads one setting written by appendValue(). Text values point into `record`.
+ */
+static bool takeValue(std::string_view &record, const ConfigField &field, ConfigValue &value)
+{
+    switch (field.type)
+    {
+    case ConfigValueType::Bool:
+    {
+        std::uint8_t flag = 0;
+        const bool taken = takeBytes(record, flag);
+        value.flag = flag != 0;
+        return taken;
+    }
+    case ConfigValueType::Integer:
+    {
+        std::int64_t integer = 0;
+        const bool taken = takeBytes(record, integer);
+        value.integer = integer;
+        return taken;
+    }
+    case ConfigValueType::Number:
+        return takeBytes(record, value.number);
+    case ConfigValueType::Choice:
+    {
+        std::int32_t choice = 0;
+        const bool taken = takeBytes(record, choice);
+        value.choice = choice;
+        return taken;
+    }
+    case ConfigValueType::Text:
+    {
+        std::uint8_t length = 0;
+        if (!takeBytes(record, length) || record.size() < length)
+        {
+            return false;
+        }
+        value.text = record.substr(0, length);
+        record.remove_prefix(length);
+        return true;
+    }
+    case ConfigValueType::Version:
+        break;
+    }
+    return false;
+}
+
+std::uint64_t configManager::configTextHash(std::string_view text)
+{
+    return fnv1a(text.data(), text.size());
+}
+
+/**
+ * @brief Writes the current settings as a snapshot of the config text with hash `textHash`.
+ *
+ * The record holds every schema setting, read through its schema row, followed by the device
+ * table. Nothing is written if a value does not fit; the next boot then just parses the text again.
+ */
+void configManager::saveSnapshot(std::uint64_t textHash) const
+{
+    std::string record;
+    bool fits = true;
+    for (const ConfigField &field : getSchema())
+    {
+        if (storedInSnapshot(field))
+        {
+            ConfigValue value;
+            field.read(*this, value);
+            fits = fits && appendValue(record, field, value);
+        }
+    }
+    for (const DeviceConfig &device : devices)
+    {
+        appendBytes(record, SnapshotDevice{device.port, static_cast<std::uint8_t>(device.gearSetting), device.reversed, {}});
+    }
+
+    if (!fits || record.size() > maxSnapshotRecordSize)
+    {
+        logHandler("configManager::saveSnapshot", "Config does not fit a snapshot; it will be parsed on every boot.", Log::Level::Debug);
+        return;
+    }
+
+    SnapshotHeader header{snapshotMagic, snapshotFormatVersion, snapshotLayoutHash(), fnv1a(Version.data(), Version.size()), textHash,
+                          static_cast<std::uint32_t>(record.size()), 0, fnv1a(record.data(), record.size())};
+    std::ofstream file(configSnapshotFileName, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        logHandler("configManager::saveSnapshot", "Could not write the config snapshot.", Log::Level::Debug);
+        return;
+    }
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(record.data(), record.size());
+}
+
+/**
+ * @brief Restores the settings from the snapshot if it was made from this config text, firmware
+ *        and schema.
+ *
+ * Every setting goes back through its schema row's apply function, as if it had been parsed.
+ *
+ * @param textHash Hash of the current config.cfg contents.
+ * @return false if there is no snapshot, it is stale, for another Version or schema, or its checksum fails.
+ */
+bool configManager::loadSnapshot(std::uint64_t textHash)
+{
+    std::ifstream file(configSnapshotFileName, std::ios::binary);
+    SnapshotHeader header{};
+    if (!file || !file.read(reinterpret_cast<char *>(&header), sizeof(header)))
+    {
+        return false;
+    }
+    if (header.magic != snapshotMagic || header.formatVersion != snapshotFormatVersion || header.layoutHash != snapshotLayoutHash() ||
+        header.versionHash != fnv1a(Version.data(), Version.size()) || header.textHash != textHash || header.recordSize > maxSnapshotRecordSize)
+    {
+        return false;
+    }
+    std::string record(header.recordSize, '\0');
+    if (!file.read(record.data(), record.size()))
+    {
+        return false;
+    }
+    if (header.checksum != fnv1a(record.data(), record.size()))
+    {
+        logHandler("configManager::loadSnapshot", "Config snapshot is corrupt; parsing the config file.", Log::Level::Warn, 2);
+        return false;
+    }
+
+    // Decode everything before applying anything, so a short record leaves the settings alone.
+    std::string_view remaining = record;
+    std::vector<std::pair<const ConfigField *, ConfigValue>> values;
+    for (const ConfigField &field : getSchema())
+    {
+        if (storedInSnapshot(field))
+        {
+            ConfigValue value;
+            if (!takeValue(remaining, field, value))
+            {
+                return false;
+            }
+            values.emplace_back(&field, value);
+        }
+    }
+    DeviceTable restored;
+    for (DeviceConfig &device : restored)
+    {
+        SnapshotDevice stored{};
+        if (!takeBytes(remaining, stored))
+        {
+            return false;
+        }
+        device = DeviceConfig{stored.port, static_cast<vex::gearSetting>(stored.gearSetting), stored.reversed != 0};
+    }
+    if (!remaining.empty())
+    {
+        return false;
+    }
+
+    for (const auto &[field, value] : values)
+    {
+        field->apply(*this, value);
+    }
+    devices = restored;
+    return true;
+}
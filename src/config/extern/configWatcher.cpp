@@ -0,0 +1,175 @@
+#include "vex.h"
+#include <memory>
+
+// Without a real-time clock the brain may not update file timestamps, so the contents are
+// hashed every few polls even when the size and timestamp look unchanged.
+constexpr std::uint32_t hashEveryPolls = 5;
+
+/**
+ * @brief Publishes the live settings staged in `source` as the ones every getter returns.
+ *
+ * Called at startup with `*this` and by the watcher with a freshly parsed candidate. Only one
+ * thread publishes at a time: the main thread before startWatching(), the watcher after.
+ */
+void configManager::publishLiveSettings(const configManager &source)
+{
+    LiveSettings next;
+    next.revision = live.version() == 0 ? 0 : live.read().revision + 1;
+    next.ctrlr1PollingRate = source.CTRLR1POLLINGRATE;
+    next.leftDeadzone = source.leftDeadzone;
+    next.rightDeadzone = source.rightDeadzone;
+    next.inputExpo = source.inputExpo;
+    next.slewRate = source.slewRate;
+    next.velocityGains = source.velocityGains;
+    next.menuStopsDrive = source.menuStopsDrive;
+    next.driveCurrentBudget = source.driveCurrentBudget;
+    next.drivePriority = source.drivePriority;
+    next.devices = source.devices;
+    live.write(next);
+}
+
+/**
+ * @brief Moves each drive motor whose port differs in `next` to its new port, without a restart.
+ *
+ * `next` is the device table of the reloaded file and is left holding the table to publish: the
+ * running one with the moved ports. Gear ratio, reversal and sensor changes still need a restart,
+ * and a motor the registry refused to move keeps its old port. Nothing shared is written here;
+ * readers see the new ports when publishLiveSettings() publishes `next`.
+ *
+ * The new motor's encoder starts from its own zero, so odometry re-baselines at the current pose
+ * and the odometer skips the jump.
+ */
+void configManager::rebindMovedMotors(DeviceTable &next)
+{
+    const DeviceTable running = live.read().devices;
+    DeviceTable published = running;
+    bool moved = false;
+    for (Device device : DeviceRegistry::driveMotors)
+    {
+        const std::size_t index = static_cast<std::size_t>(device);
+        const int port = next[index].port;
+        if (port == running[index].port)
+        {
+            continue;
+        }
+        // Before begin() the devices do not exist yet and are built from the published table.
+        if (Devices.isReady() && !Devices.rebindMotor(device, port))
+        {
+            continue;
+        }
+        published[index].port = port;
+        moved = true;
+    }
+    next = published;
+    if (moved)
+    {
+        DriveOdometry.reset(DriveOdometry.getPose());
+        odometerRebaseline.store(true, std::memory_order_release);
+    }
+}
+
+/**
+ * @brief Parses the config file again if it changed since it was last loaded, and publishes its
+ *        live settings.
+ *
+ * The file is parsed into a separate, parse-only configManager, so nothing the running code
+ * reads is touched until the single publish at the end, and the maintenance journal is left to
+ * the journal thread. A file with errors, e.g. one saved halfway through an edit, is not
+ * applied; the next change is.
+ *
+ * @return true if new settings were published.
+ */
+bool configManager::reloadConfig()
+{
+    if (!Brain.SDcard.isInserted() || !Brain.SDcard.exists(configFileName.c_str()))
+    {
+        return false;
+    }
+    std::string configText;
+    if (!readConfigFile(configText))
+    {
+        return false;
+    }
+    const std::uint64_t textHash = configTextHash(configText);
+    if (textHash == loadedTextHash)
+    {
+        return false;
+    }
+    loadedTextHash = textHash; // Report a broken file once, not every poll
+
+    auto candidate = std::make_unique<configManager>(configFileName, ParseOnly{});
+    if (!candidate->setValuesFromConfig(configText))
+    {
+        logHandler("configWatcher", "Config file changed but has errors. Keeping the running settings.", Log::Level::Warn, 3);
+        return false;
+    }
+    rebindMovedMotors(candidate->devices);
+    publishLiveSettings(*candidate);
+    logHandler("configWatcher", std::format("Reloaded config (revision {}).", getLiveRevision()), Log::Level::Info, 2);
+    return true;
+}
+
+/**
+ * @brief Writes the settings changed at runtime back to the config file once their debounce has
+ *        passed; see ConfigFileStore. Called by the watcher on every poll.
+ *
+ * @param nowMs Current time.
+ * @return true if the file was rewritten.
+ */
+bool configManager::writeBackSettings(std::uint32_t nowMs)
+{
+    std::string writtenText;
+    if (!configStore.isDue(nowMs) || !configStore.flush(writtenText))
+    {
+        return false;
+    }
+    loadedTextHash = configTextHash(writtenText); // Not a change to reload
+    return true;
+}
+
+/**
+ * @brief Starts watching the config file for changes. Calling it again does nothing.
+ *
+ * Settings outside LiveSettings (drive output, logging, ...) still need a restart, except a drive
+ * motor's port; see rebindMovedMotors().
+ * The same thread writes settings changed at runtime, such as the drive mode, back to the file.
+ *
+ * @param periodMs How often the file is checked.
+ */
+void configManager::startWatching(std::uint32_t periodMs)
+{
+    if (watching)
+    {
+        return;
+    }
+    watchPeriodMs = periodMs;
+    watching = true;
+    vex::thread watchThread(watchTask, this);
+    watchThread.detach();
+}
+
+int configManager::watchTask(void *arg)
+{
+    auto *self = static_cast<configManager *>(arg);
+    std::int32_t lastSize = -1;
+    std::uint32_t lastTimestamp = 0;
+    for (std::uint32_t polls = 1;; ++polls)
+    {
+        vex::this_thread::sleep_for(self->watchPeriodMs);
+        if (!Brain.SDcard.isInserted())
+        {
+            continue;
+        }
+        self->writeBackSettings(vex::timer::system());
+        const std::int32_t size = Brain.SDcard.size(self->configFileName.c_str());
+        const std::uint32_t timestamp = Brain.SDcard.timestamp(self->configFileName.c_str());
+        if (size == lastSize && timestamp == lastTimestamp && polls % hashEveryPolls != 0)
+        {
+            continue;
+        }
+        lastSize = size;
+        lastTimestamp = timestamp;
+        self->reloadConfig();
+    }
+    return 0;
+}
@@ -0,0 +1,176 @@
+#include "vex.h"
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+constexpr std::uint32_t journalRecordMagic = 0x4A4E544D; // "MTNJ"
+
+/**
+ * @struct JournalRecord
+ * @brief One journal entry: the whole maintenance state, so any single valid record restores it.
+ */
+struct JournalRecord
+{
+    std::uint32_t magic;
+    std::uint32_t sequence;
+    std::int32_t odometer;
+    std::int32_t lastService;
+    std::int32_t serviceInterval;
+    std::uint32_t crc; ///< CRC-32 of every field above.
+};
+static_assert(sizeof(JournalRecord) == 24, "Journal records are read back in fixed 24-byte steps");
+
+static std::uint32_t crc32(const void *data, std::size_t size)
+{
+    const auto *bytes = static_cast<const std::uint8_t *>(data);
+    std::uint32_t crc = 0xFFFFFFFF;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        crc ^= bytes[i];
+        for (int bit = 0; bit < 8; ++bit)
+        {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+MaintenanceJournal::MaintenanceJournal(std::string_view firstFileName, std::string_view secondFileName)
+    : fileNames{std::string(firstFileName), std::string(secondFileName)}
+{
+}
+
+/**
+ * @brief Finds the newest valid record in either journal file.
+ *
+ * Records with a bad magic number or CRC, and a partial record at the end of a file, are
+ * skipped. The next append() starts a fresh file, so nothing is ever appended after them.
+ *
+ * @param state Set to the recovered values; untouched if there is no valid record.
+ * @return true if a valid record was found.
+ */
+bool MaintenanceJournal::recover(State &state)
+{
+    bool found = false;
+    for (std::size_t file = 0; file < 2; ++file)
+    {
+        std::ifstream in(fileNames[file], std::ios::binary);
+        if (!in)
+        {
+            continue;
+        }
+        const std::string contents((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        for (std::size_t offset = 0; offset + sizeof(JournalRecord) <= contents.size(); offset += sizeof(JournalRecord))
+        {
+            JournalRecord record;
+            std::memcpy(&record, contents.data() + offset, sizeof(record));
+            if (record.magic != journalRecordMagic || record.crc != crc32(&record, offsetof(JournalRecord, crc)))
+            {
+                continue;
+            }
+            if (!found || record.sequence > sequence)
+            {
+                found = true;
+                sequence = record.sequence;
+                activeFile = file;
+                state.odometer = record.odometer;
+                state.lastService = record.lastService;
+                state.serviceInterval = record.serviceInterval;
+            }
+        }
+    }
+    compactNext = true;
+    return found;
+}
+
+/**
+ * @brief Appends `state` as the newest record, compacting into the other file when due.
+ *
+ * Blocks on the SD card; call it from a background thread, never the control loop.
+ *
+ * @return true if the record was written.
+ */
+bool MaintenanceJournal::append(const State &state)
+{
+    const bool compact = compactNext || activeRecords >= recordsPerFile;
+    const std::size_t file = compact ? 1 - activeFile : activeFile;
+
+    JournalRecord record{journalRecordMagic, sequence + 1, state.odometer, state.lastService, state.serviceInterval, 0};
+    record.crc = crc32(&record, offsetof(JournalRecord, crc));
+
+    std::ofstream out(fileNames[file], std::ios::binary | (compact ? std::ios::trunc : std::ios::app));
+    out.write(reinterpret_cast<const char *>(&record), sizeof(record));
+    out.close();
+    if (!out)
+    {
+        compactNext = true; // Part of the record may have been written
+        return false;
+    }
+    sequence = record.sequence;
+    activeFile = file;
+    activeRecords = compact ? 1 : activeRecords + 1;
+    compactNext = false;
+    return true;
+}
+
+/**
+ * @brief Starts the thread that writes queued maintenance values to the journal. Calling it
+ *        again does nothing.
+ *
+ * @param periodMs Shortest time between two journal writes. Values queued in between are
+ *                 merged, so at most the last period of odometer progress is lost at power-off.
+ */
+void configManager::startMaintenanceJournal(std::uint32_t periodMs)
+{
+    if (journaling)
+    {
+        return;
+    }
+    journalPeriodMs = periodMs;
+    journaling = true;
+    vex::thread journalThread(maintenanceTask, this);
+    journalThread.detach();
+}
+
+int configManager::maintenanceTask(void *arg)
+{
+    auto *self = static_cast<configManager *>(arg);
+    bool failureLogged = false;
+    while (true)
+    {
+        vex::this_thread::sleep_for(self->journalPeriodMs);
+
+        MaintenanceJournal::State state;
+        self->maintenanceMutex.lock();
+        const bool dirty = self->maintenanceDirty;
+        state = self->pendingMaintenance;
+        self->maintenanceDirty = false;
+        self->maintenanceMutex.unlock();
+
+        if (!dirty)
+        {
+            continue;
+        }
+        if (Brain.SDcard.isInserted() && self->maintenanceJournal.append(state))
+        {
+            failureLogged = false;
+            continue;
+        }
+
+        // Keep the values for the next period unless newer ones were queued meanwhile
+        self->maintenanceMutex.lock();
+        if (!self->maintenanceDirty)
+        {
+            self->pendingMaintenance = state;
+            self->maintenanceDirty = true;
+        }
+        self->maintenanceMutex.unlock();
+        if (!failureLogged)
+        {
+            logHandler("maintenanceJournal", "Could not write maintenance journal.", Log::Level::Warn, 3);
+            failureLogged = true;
+        }
+    }
+    return 0;
+}
@@ -1,4 +1,6 @@
 #include "vex.h"
+#include <algorithm>
+#include <charconv>
 #include <fstream>
 
 /**
@@ -6,8 +8,8 @@
  *
  * This function prompts the user with a custom message to decide whether to reset the configuration.
  * If the user selects "Yes", it outputs a notification on the screen, attempts to open the configuration
- * file for writing, and writes a default configuration to it. The default configuration includes various
- * system and motor settings, such as motor ports, gear ratios, reversal statuses, and other system parameters.
+ * file for writing, and writes a default configuration to it: the default device placement, then
+ * every key of the config schema with its default value.
  *
  * @param message A std::string_view containing the message to display when asking the user
  *                if they want to reset the configuration.
@@ -18,7 +20,7 @@
  * - If "Yes" is selected:
  *   - Notifies the user via the primary screen that the configuration is being reset.
  *   - Attempts to create/open the configuration file. If unsuccessful, logs a warning and exits.
- *   - Writes the default configuration settings into the file, ending with the current version.
+ *   - Writes the schema defaults through writeDefaultConfig(), ending with the current version.
  *   - Logs a debug message indicating a successful reset.
  * - If the user selects "No", no changes are made.
  */
@@ -35,53 +37,7 @@ void configManager::resetOrInitializeConfig(std::string_view message)
             logHandler("resetOrInitializeConfig", "Could not create config.", Log::Level::Warn, 3);
             return;
         }
-        // Write default configuration
-        configFile << R"(
-    # Config File:
-    MOTOR_CONFIG {
-        FRONT_LEFT_MOTOR {
-        PORT=1
-        GEAR_RATIO=6_1
-        REVERSED=false
-        }
-        FRONT_RIGHT_MOTOR {
-        PORT=10
-        GEAR_RATIO=6_1
-        REVERSED=true
-        }
-        REAR_LEFT_MOTOR {
-        PORT=11
-        GEAR_RATIO=6_1
-        REVERSED=false
-        }
-        REAR_RIGHT_MOTOR {
-        PORT=20
-        GEAR_RATIO=6_1
-        REVERSED=true
-        }
-        INERTIAL {
-        PORT=3
-        }
-        Rear_Bumper {
-        PORT=A
-        }
-    }
-    PRINTLOGO=true
-    LOGTOFILE=true
-    MAXOPTIONSSIZE=4
-    POLLINGRATE=5
-    CTRLR1POLLINGRATE=25
-    CONFIGTYPE=Controller
-    TEAMNUMBER=12
-    LOADINGGIFPATH=loading.gif
-    AUTOGIFPATH=auto.gif
-    DRIVEGIFPATH=drive.gif
-    vsyncGif=true
-    DRIVEMODE=Split
-    LEFTDEADZONE=10
-    RIGHTDEADZONE=10
-    VERSION=)" << Version
-                   << "\n";
+        writeDefaultConfig(configFile);
         configFile.close();
 
         logHandler("resetConfig", "Successfully reset config file.", Log::Level::Debug);
@@ -89,34 +45,29 @@ void configManager::resetOrInitializeConfig(std::string_view message)
 }
 
 /**
- * @brief Writes maintenance data to a file.
+ * @brief Queues the current maintenance values for the maintenance journal.
  *
- * This function opens the file specified by the maintenanceFileName, and if the file is successfully opened,
- * it writes the current maintenance values as key/value pairs. The keys include:
- * - ODOMETER
- * - LAST_SERVICE
- * - SERVICE_INTERVAL
- *
- * Each key is followed by its corresponding value and a newline character. Finally, the file is closed.
+ * Never touches the SD card: the journal thread started by startMaintenanceJournal() appends
+ * the latest queued values at most once per period. Unchanged values are not queued.
  */
 void configManager::writeMaintenanceData()
 {
-    std::ofstream maintenanceFile(maintenanceFileName);
-    if (maintenanceFile.is_open())
+    const MaintenanceJournal::State state{odometer, lastService, serviceInterval};
+    maintenanceMutex.lock();
+    if (state != pendingMaintenance)
     {
-        maintenanceFile << "ODOMETER=" << odometer << "\n";
-        maintenanceFile << "LAST_SERVICE=" << lastService << "\n";
-        maintenanceFile << "SERVICE_INTERVAL=" << serviceInterval << "\n";
-        maintenanceFile.close();
+        pendingMaintenance = state;
+        maintenanceDirty = true;
     }
+    maintenanceMutex.unlock();
 }
 
 /**
  * @brief Updates the drive mode setting for the configManager.
  *
- * This function sets the in-memory drive mode and persists the change by appending
- * the corresponding mode value to the configuration file. The drive mode is written
- * as a string representing the corresponding DriveMode enumeration value.
+ * This function sets the in-memory drive mode and stages the change for the config file. The
+ * config watcher rewrites the DRIVEMODE line in place once the driver stops changing modes;
+ * see ConfigFileStore.
  *
  * @param mode The drive mode to be set. Valid values are:
  *             - DriveMode::LeftArcade
@@ -127,48 +78,59 @@ void configManager::writeMaintenanceData()
 void configManager::setDriveMode(const configManager::DriveMode &mode)
 {
     driveMode = mode; // Update in-memory
-
-    // Also write to config file
-    std::ofstream configFile(configFileName, std::ios::app);
-    if (configFile.is_open())
-    {
-        configFile << "DRIVEMODE=";
-        switch (mode)
-        {
-        case DriveMode::LeftArcade:
-            configFile << "LeftArcade";
-            break;
-        case DriveMode::RightArcade:
-            configFile << "RightArcade";
-            break;
-        case DriveMode::SplitArcade:
-            configFile << "SplitArcade";
-            break;
-        case DriveMode::Tank:
-            configFile << "Tank";
-            break;
-        }
-        configFile << "\n";
-        configFile.close();
-    }
+    configStore.set("DRIVEMODE", configChoiceName("DRIVEMODE", static_cast<int>(mode)), vex::timer::system());
 }
 
+enum class MaintenanceValue
+{
+    Odometer,
+    LastService,
+    ServiceInterval
+};
+
 /**
- * @brief Reads maintenance data from the specified file.
+ * @struct MaintenanceKey
+ * @brief A key of the older maintenance file and the value it holds.
+ */
+struct MaintenanceKey
+{
+    std::string_view name;
+    MaintenanceValue value;
+};
+
+static constexpr std::array maintenanceKeys = {
+    MaintenanceKey{"ODOMETER", MaintenanceValue::Odometer},
+    MaintenanceKey{"LAST_SERVICE", MaintenanceValue::LastService},
+    MaintenanceKey{"SERVICE_INTERVAL", MaintenanceValue::ServiceInterval},
+};
+static constexpr auto maintenanceKeyIndex = buildConfigKeyIndex<8>(maintenanceKeys, &MaintenanceKey::name);
+static_assert(maintenanceKeyIndex.found, "Maintenance keys must hash without collisions; add a seed or grow the table");
+
+/**
+ * @brief Restores the maintenance values at boot.
  *
- * This function opens the maintenance file using the filename stored in 'maintenanceFileName'.
- * It reads the file line by line, expecting each line to be in the format "KEY=VALUE".
- * For each line, it parses the key and its associated value, and based on the key,
- * converts the value to the appropriate numeric type using the 'stringToNumber' template:
+ * The newest valid record of the maintenance journal wins; see MaintenanceJournal::recover().
+ * Without a journal, the values are read from the older key/value file named by
+ * 'maintenanceFileName', one "KEY=VALUE" per line, with keys looked up like config keys:
  *
  *   - "ODOMETER": Converts the value to an int and assigns it to 'odometer'.
  *   - "LAST_SERVICE": Converts the value to a long and assigns it to 'lastService'.
  *   - "SERVICE_INTERVAL": Converts the value to a long and assigns it to 'serviceInterval'.
  *
- * The file is closed after processing is complete.
+ * The journal's first write then carries those values over.
  */
 void configManager::readMaintenanceData()
 {
+    MaintenanceJournal::State state;
+    if (maintenanceJournal.recover(state))
+    {
+        odometer = state.odometer;
+        lastService = state.lastService;
+        serviceInterval = state.serviceInterval;
+        pendingMaintenance = state;
+        return;
+    }
+
     std::ifstream maintenanceFile(maintenanceFileName);
     if (maintenanceFile.is_open())
     {
@@ -177,24 +139,28 @@ void configManager::readMaintenanceData()
         {
             std::istringstream iss(line);
             std::string key, value;
-            if (std::getline(iss, key, '=') && std::getline(iss, value))
+            const MaintenanceKey *field = nullptr;
+            if (std::getline(iss, key, '=') && std::getline(iss, value) &&
+                (field = findConfigKey(maintenanceKeyIndex, maintenanceKeys, &MaintenanceKey::name, key)) != nullptr)
             {
-                if (key == "ODOMETER")
+                switch (field->value)
                 {
+                case MaintenanceValue::Odometer:
                     odometer = stringToNumber<int>(value);
-                }
-                else if (key == "LAST_SERVICE")
-                {
+                    break;
+                case MaintenanceValue::LastService:
                     lastService = stringToNumber<long>(value);
-                }
-                else if (key == "SERVICE_INTERVAL")
-                {
+                    break;
+                case MaintenanceValue::ServiceInterval:
                     serviceInterval = stringToNumber<long>(value);
+                    break;
                 }
             }
         }
         maintenanceFile.close();
     }
+    pendingMaintenance = {};
+    writeMaintenanceData(); // Queues the carried-over values if they differ from the defaults
 }
 
 // Method to convert a string to boolean
@@ -213,7 +179,8 @@ bool configManager::stringToBool(std::string_view str)
 {
     if (str.empty())
     {
-        logHandler("stringToBool", "Empty string cannot be converted to boolean", Log::Level::Error);
+        logHandler("stringToBool", "Empty string cannot be converted to boolean" + locationSuffix(), Log::Level::Error);
+        ++parseErrors;
         return false;
     }
 
@@ -227,7 +194,8 @@ bool configManager::stringToBool(std::string_view str)
     }
     else
     {
-        logHandler("stringToBool", std::format("Invalid boolean string: {}", str), Log::Level::Error);
+        logHandler("stringToBool", std::format("Invalid boolean string: {}{}", str, locationSuffix()), Log::Level::Error);
+        ++parseErrors;
         return false;
     }
 }
@@ -236,16 +204,13 @@ bool configManager::stringToBool(std::string_view str)
 /**
  * @brief Converts a string representation to a numeric value of type T.
  *
- * This template function attempts to convert a given string view into the numeric type T.
- * The conversion supports the following types:
- *   - int: Uses std::stoi.
- *   - long: Uses std::stol.
- *   - double: Uses std::stod.
- *   - std::size_t: Uses std::stoul (with a static_cast to std::size_t).
+ * This template function converts the given string view into the numeric type T with
+ * std::from_chars, so nothing is allocated and no exceptions are thrown. The whole string
+ * must be a number; trailing characters are an error.
  *
- * If the input string is empty, the function logs an error and returns a default-constructed value of T.
- * In case of conversion errors (invalid_argument or out_of_range), the function catches the exception,
- * logs the error, and returns a default-constructed value of T.
+ * If the input string is empty or is not a valid number for T, the function logs an error
+ * (with the config line and column while a config file is being parsed) and returns a
+ * default-constructed value of T.
  *
  * @tparam T The numeric type for the conversion.
  * @param str The string view containing the number to be converted.
@@ -256,223 +221,220 @@ T configManager::stringToNumber(std::string_view str)
 {
     if (str.empty())
     {
-        logHandler("stringToNumber", "Empty string cannot be converted to number", Log::Level::Error);
+        logHandler("stringToNumber", "Empty string cannot be converted to number" + locationSuffix(), Log::Level::Error);
+        ++parseErrors;
         return T{};
     }
 
-    try
+    T result{};
+    auto [end, error] = std::from_chars(str.data(), str.data() + str.size(), result);
+    if (error == std::errc::result_out_of_range)
     {
-        if constexpr (std::is_same_v<T, int>)
-        {
-            return std::stoi(std::string(str));
-        }
-        else if constexpr (std::is_same_v<T, long>)
-        {
-            return std::stol(std::string(str));
-        }
-        else if constexpr (std::is_same_v<T, double>)
-        {
-            return std::stod(std::string(str));
-        }
-        else if constexpr (std::is_same_v<T, std::size_t>)
-        {
-            return static_cast<std::size_t>(std::stoul(std::string(str)));
-        }
+        logHandler("stringToNumber", std::format("Out of range: {}{}", str, locationSuffix()), Log::Level::Error);
+        ++parseErrors;
+        return T{};
     }
-    catch (const std::invalid_argument &e)
+    if (error != std::errc{} || end != str.data() + str.size())
     {
-        logHandler("stringToNumber", std::format("Invalid argument: {}", str), Log::Level::Error);
+        logHandler("stringToNumber", std::format("Invalid argument: {}{}", str, locationSuffix()), Log::Level::Error);
+        ++parseErrors;
+        return T{};
     }
-    catch (const std::out_of_range &e)
+    return result;
+}
+
+// Used by parseConfigValue() in configSchema.cpp.
+template long long configManager::stringToNumber<long long>(std::string_view str);
+template double configManager::stringToNumber<double>(std::string_view str);
+
+/**
+ * @brief Returns " (line L, column C)" while a config file is being parsed, otherwise nothing.
+ */
+std::string configManager::locationSuffix() const
+{
+    if (parseLocation.line == 0)
     {
-        logHandler("stringToNumber", std::format("Out of range: {}", str), Log::Level::Error);
+        return {};
     }
+    return std::format(" (line {}, column {})", parseLocation.line, parseLocation.column);
+}
 
-    return T{};
+static std::string_view trimConfigText(std::string_view text)
+{
+    constexpr std::string_view whitespace = " \t\r";
+    std::size_t first = text.find_first_not_of(whitespace);
+    if (first == std::string_view::npos)
+    {
+        return {};
+    }
+    return text.substr(first, text.find_last_not_of(whitespace) - first + 1);
 }
 
 // Method to set values from the config file and parse complex config sections
 /**
  * @brief Reads and applies configuration values from a config file.
  *
- * This function opens the configuration file specified by the internal variable (configFileName) and
- * iterates over each line to parse and apply configuration settings. It handles key-value pairs separated
- * by '=' and processes several recognized configuration keys such as:
- *   - ConfigType: Sets the configuration type by converting the string value.
- *   - TeamNumber: Sets the team number.
- *   - LoadingGifPath, AutoGifPath, DriverGifPath: Set file paths for various GIF resources.
- *   - VsyncGif, PRINTLOGO, LOGTOFILE: Convert string values to bool and store the settings.
- *   - MAXOPTIONSSIZE, POLLINGRATE, CTRLR1POLLINGRATE: Convert string values to numeric types.
- *   - LOGLEVEL: Converts the value to a log level type.
- *   - DRIVEMODE: Maps string values ("Arcade", "SplitArcade", "Tank", "Custom") to corresponding drive modes.
- *   - LEFTDEADZONE, RIGHTDEADZONE: Set deadzone values for controllers.
- *   - VERSION: Checks for a version mismatch between the configuration file and code.
+ * The file, already read into one buffer, is parsed in a single pass; keys, values and section
+ * names are string views into that buffer. Leading indentation is ignored. Two kinds of lines
+ * are accepted besides comments (`;` or `#`) and blank lines:
+ *   - `KEY=VALUE` at the top level, dispatched through applyConfigValue().
+ *   - `NAME {` ... `}` blocks (the brace may also be on its own line). A section such as
+ *     MOTOR_CONFIG holds one block per device with PORT, GEAR_RATIO and REVERSED fields.
+ *
+ * Top-level keys, their types, ranges and defaults are listed once in the schema in
+ * configSchema.cpp. Keys are matched without regard to case, choices such as DRIVEMODE
+ * accept a few older spellings ("Arcade", "Split"), and numbers outside their range are
+ * clamped with a warning.
  *
- * Additionally, it processes configuration sections (e.g., MOTOR_CONFIG, INERTIAL, TRIPORT_CONFIG) by:
- *   - Reading section-specific keys and values surrounded by braces.
- *   - Setting motor configurations (ports, gear ratios, reversed flags), inertial ports, and tri-port configurations.
+ * Unknown keys and fields are logged with their line and column and ignored. The first
+ * malformed line offers a config reset, as before, except during a background reload.
  *
- * If the configuration file cannot be opened, or if an invalid or unrecognized key/line is encountered,
- * appropriate warnings are logged. The function may also trigger a config reset or initialization process
- * when encountering invalid lines.
+ * @param text The contents of the config file.
+ * @return true if the file parsed without any errors.
  */
-void configManager::setValuesFromConfig()
+bool configManager::setValuesFromConfig(std::string_view text)
 {
-    std::ifstream configFile(configFileName);
-    if (!configFile)
+    parseErrors = 0;
+
+    struct Block
     {
-        logHandler("setValForConfig", "Could not open config file. Reason Unknown.", Log::Level::Warn, 4);
-        return;
-    }
+        std::string_view name;
+        DeviceBlock fields;
+    };
+    std::array<Block, 2> blocks; // Section, then device
+    std::size_t depth = 0;
+    std::string_view pendingName;
+    bool resetOffered = false;
 
-    std::string configLine;
-    while (std::getline(configFile, configLine))
+    auto syntaxError = [&](std::string_view message)
     {
-        if (configLine.empty() || configLine[0] == ';' || configLine[0] == '#')
+        ++parseErrors;
+        logHandler("setValuesFromConfig", std::format("{}{}", message, locationSuffix()), Log::Level::Warn, 4);
+        if (!resetOffered && interactive)
+        {
+            resetOffered = true;
+            resetOrInitializeConfig(std::format("Invalid line {} in config file. Do you want to reset the config?", parseLocation.line));
+        }
+    };
+
+    std::size_t lineStart = 0;
+    for (std::size_t lineNumber = 1; lineStart < text.size(); ++lineNumber)
+    {
+        std::size_t lineEnd = text.find('\n', lineStart);
+        if (lineEnd == std::string_view::npos)
+        {
+            lineEnd = text.size();
+        }
+        const std::string_view rawLine = text.substr(lineStart, lineEnd - lineStart);
+        const std::string_view line = trimConfigText(rawLine);
+        parseLocation = {lineNumber, static_cast<std::size_t>(line.data() - rawLine.data()) + 1};
+        lineStart = lineEnd + 1;
+
+        if (line.empty() || line[0] == ';' || line[0] == '#')
         {
             continue; // Skip empty lines and comments
         }
 
-        std::istringstream iss(configLine);
-        std::string key, value;
-        if (std::getline(iss, key, '=') && std::getline(iss, value))
+        if (line == "}")
         {
-            if (key == "ConfigType")
-            {
-                configType = stringToConfigType(value);
-            }
-            else if (key == "TeamNumber")
-            {
-                setTeamNumber(value);
-            }
-            else if (key == "LoadingGifPath")
-            {
-                setLoadingGifPath(value);
-            }
-            else if (key == "AutoGifPath")
-            {
-                setAutoGifPath(value);
-            }
-            else if (key == "DriverGifPath")
+            if (depth == 0)
             {
-                setDriverGifPath(value);
+                syntaxError("Unmatched '}'");
+                continue;
             }
-            else if (key == "VsyncGif")
+            if (depth == 2)
             {
-                SetVsyncGif(stringToBool(value));
+                const Block &device = blocks[1];
+                applyDeviceConfig(blocks[0].name, device.name, device.fields);
             }
-            else if (key == "PRINTLOGO")
-            {
-                setPrintLogo(stringToBool(value));
-            }
-            else if (key == "LOGTOFILE")
-            {
-                setLogToFile(stringToBool(value));
-            }
-            else if (key == "MAXOPTIONSSIZE")
-            {
-                setMaxOptionSize(stringToNumber<std::size_t>(value));
-            }
-            else if (key == "POLLINGRATE")
-            {
-                setPollingRate(stringToNumber<std::size_t>(value));
-            }
-            else if (key == "CTRLR1POLLINGRATE")
-            {
-                setCtrlr1PollingRate(stringToNumber<std::size_t>(value));
-            }
-            else if (key == "LOGLEVEL")
-            {
-                setLogLevel(stringToLogLevel(value));
-            }
-            else if (key == "DRIVEMODE")
-            {
-                if (value == "Arcade")
-                    setDriveMode(DriveMode::LeftArcade);
-                else if (value == "SplitArcade")
-                    setDriveMode(DriveMode::RightArcade);
-                else if (value == "Tank")
-                    setDriveMode(DriveMode::SplitArcade);
-                else if (value == "Custom")
-                    setDriveMode(DriveMode::Tank);
-            }
-            else if (key == "LEFTDEADZONE")
+            --depth;
+            continue;
+        }
+
+        std::string_view blockName;
+        if (line == "{")
+        {
+            blockName = pendingName;
+        }
+        else if (line.back() == '{')
+        {
+            blockName = trimConfigText(line.substr(0, line.size() - 1));
+        }
+        if (line.back() == '{')
+        {
+            pendingName = {};
+            if (blockName.empty() || depth == blocks.size())
             {
-                setLeftDeadzone(stringToNumber<int>(value));
+                syntaxError(blockName.empty() ? "Block without a name" : "Blocks nest at most two deep");
+                continue;
             }
-            else if (key == "RIGHTDEADZONE")
+            blocks[depth] = Block{};
+            blocks[depth++].name = blockName;
+            continue;
+        }
+
+        const std::size_t equals = line.find('=');
+        if (equals == std::string_view::npos)
+        {
+            pendingName = line; // A block name with its brace on the next line
+            continue;
+        }
+        pendingName = {};
+
+        const std::string_view key = trimConfigText(line.substr(0, equals));
+        const std::string_view value = trimConfigText(line.substr(equals + 1));
+        if (depth == 0)
+        {
+            if (!applyConfigValue(key, value))
             {
-                setRightDeadzone(stringToNumber<int>(value));
+                ++parseErrors;
+                logHandler("setValuesFromConfig", std::format("Unknown key in config file: {}{}. This value will be ignored.", key, locationSuffix()), Log::Level::Warn, 4);
             }
-            else if (key == "VERSION")
+        }
+        else if (depth == 2)
+        {
+            DeviceFieldKey field;
+            if (findDeviceField(key, field))
             {
-                if (value != Version)
-                {
-                    logHandler("setValuesFromConfig", std::format("Version mismatch with Config file ({}) and code version ({}). Potential problems may occur.", value, Version), Log::Level::Warn, 4);
-                }
+                blocks[1].fields[static_cast<std::size_t>(field)] = value;
             }
             else
             {
-                logHandler("setValuesFromConfig", std::format("Unknown key in config file: {}. This value will be ignored.", value), Log::Level::Warn, 4);
-            }
-        }
-        else if (key == "MOTOR_CONFIG" || key == "INERTIAL" || key == "TRIPORT_CONFIG")
-        {
-            std::string section = key;
-            while (std::getline(configFile, configLine) && configLine != "}")
-            {
-                if (configLine.empty() || configLine.starts_with(';') || configLine.starts_with('#'))
-                {
-                    continue; // Skip empty lines and comments
-                }
-
-                std::string name = configLine;
-                std::getline(configFile, configLine); // Skip the opening brace
-
-                std::string port, gearRatio, reversedStr;
-                while (std::getline(configFile, configLine) && configLine != "}")
-                {
-                    std::istringstream iss(configLine);
-                    std::string configKey, configValue;
-                    if (std::getline(iss, configKey, '=') && std::getline(iss, configValue))
-                    {
-                        if (configKey == "PORT")
-                        {
-                            port = configValue;
-                        }
-                        else if (configKey == "GEAR_RATIO")
-                        {
-                            gearRatio = configValue;
-                        }
-                        else if (configKey == "REVERSED")
-                        {
-                            reversedStr = configValue;
-                        }
-                    }
-                }
-
-                if (section == "MOTOR_CONFIG")
-                {
-                    motorPorts[name] = stringToNumber<int>(port);
-                    motorGearRatios[name] = gearRatio;
-                    motorReversed[name] = stringToBool(reversedStr);
-                }
-                else if (section == "INERTIAL")
-                {
-                    inertialPorts[name] = stringToNumber<int>(port);
-                }
-                else if (section == "TRIPORT_CONFIG")
-                {
-                    triPorts[name] = getTriPort(port);
-                }
+                ++parseErrors;
+                logHandler("setValuesFromConfig", std::format("Unknown device field {}{}", key, locationSuffix()), Log::Level::Warn, 3);
             }
         }
         else
         {
-            resetOrInitializeConfig(std::format("Invalid line in config file: {}. Do you want to reset the config?", configLine));
+            syntaxError(std::format("{} must be inside a device block", key));
         }
     }
-    configFile.close();
+
+    if (depth != 0)
+    {
+        syntaxError(std::format("Missing '}}' for {}", blocks[depth - 1].name));
+    }
+    parseLocation = {};
+    return parseErrors == 0;
+}
+
+/**
+ * @brief Reads the whole config file into `buffer`.
+ *
+ * @return false if the file could not be opened.
+ */
+bool configManager::readConfigFile(std::string &buffer) const
+{
+    std::ifstream configFile(configFileName, std::ios::binary | std::ios::ate);
+    if (!configFile)
+    {
+        logHandler("setValForConfig", "Could not open config file. Reason Unknown.", Log::Level::Warn, 4);
+        return false;
+    }
+    buffer.assign(static_cast<std::size_t>(configFile.tellg()), '\0');
+    configFile.seekg(0);
+    configFile.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    return static_cast<bool>(configFile);
 }
 
 // Method to parse the config file
@@ -486,49 +448,57 @@ void configManager::setValuesFromConfig()
  *   - If an SD card is present, verifies the existence of the configuration file.
  *     - If the file does not exist, prompts the user to reset or initialize the configuration.
  *     - Otherwise, loads configuration values from the file.
- *   - If no SD card is detected, sets default configuration values, such as polling rates, log settings,
- *     drive mode, deadzones, and service intervals.
- * - Calibrating the gyro sensor.
- * - Playing a GIF using the Vsync GIF.
- * - Setting the drivetrain's stopping mode to 'coast'.
+ *   - If no SD card is detected, applies the schema defaults with file logging and input recording
+ *     off, and resets the service intervals.
+ * - Publishing the live settings.
  *
- * @note This function interacts with external components like Brain, primaryController, Drivetrain,
- *       and logging mechanisms to perform its tasks.
+ * Building the devices, calibrating the gyro and playing the logo are separate boot steps that
+ * depend on this one; see main().
  *
- * @see calibrateGyro(), gifplayer(), getVsyncGif()
+ * @note This function interacts with external components like Brain, primaryController
+ *       and logging mechanisms to perform its tasks.
  */
 void configManager::parseConfig()
 {
+    Metrics.mark(SessionMetrics::Milestone::ConfigStart);
     logHandler("main", std::format("Version: {} | Build date: {}", Version, BuildDate), Log::Level::Info);
     primaryController.Screen.print("Starting up...");
 
     if (Brain.SDcard.isInserted())
     {
+        configStore.recover();
         if (!Brain.SDcard.exists(configFileName.c_str()))
         {
             resetOrInitializeConfig("Missing config file. Create it?");
         }
-        setValuesFromConfig();
+
+        // A snapshot of the last clean parse of this exact file skips the text parser.
+        std::string configText;
+        if (readConfigFile(configText))
+        {
+            const std::uint64_t textHash = configTextHash(configText);
+            loadedTextHash = textHash;
+            if (loadSnapshot(textHash))
+            {
+                logHandler("configParser", "Loaded config snapshot.", Log::Level::Debug);
+            }
+            else if (setValuesFromConfig(configText))
+            {
+                saveSnapshot(textHash);
+            }
+        }
     }
     else
     {
-        // Default values
-        POLLINGRATE = 5;
-        PRINTLOGO = true;
+        // Schema defaults, except what needs the SD card
+        applyDefaults();
         logToFile = false;
-        maxOptionSize = 4;
-        CTRLR1POLLINGRATE = 25;
-        logLevel = Log::Level::Info;
-        driveMode = DriveMode::SplitArcade;
-        configType = ConfigType::Controller;
+        recordInput = false;
         odometer = 0;
         lastService = 0;
         serviceInterval = 1000;
-        leftDeadzone = 10;  // Default left deadzone
-        rightDeadzone = 10; // Default right deadzone
         logHandler("configParser", "No SD card installed. Using default values.", Log::Level::Info);
     }
-    calibrateGyro();
-    gifplayer(getVsyncGif());
-    Drivetrain.setStopping(vex::brakeType::coast);
+    publishLiveSettings(*this);
+    Metrics.mark(SessionMetrics::Milestone::ConfigEnd);
 }
\ No newline at end of file
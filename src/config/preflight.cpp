@@ -0,0 +1,112 @@
+#include "vex.h"
+
+/**
+ * @struct PreflightMotor
+ * @brief A vex::motor in the units PreflightCheck works in.
+ */
+struct PreflightMotor
+{
+    vex::motor *motor;
+
+    bool installed() { return motor->installed(); }
+    double temperatureC() { return motor->temperature(vex::temperatureUnits::celsius); }
+    double positionDeg() { return motor->position(vex::rotationUnits::deg); }
+    double currentAmps() { return motor->current(vex::currentUnits::amp); }
+    void spinVolts(double volts) { motor->spin(vex::directionType::fwd, volts, vex::voltageUnits::volt); }
+    void coast() { motor->stop(vex::brakeType::coast); }
+};
+
+/**
+ * @struct PreflightImu
+ * @brief A vex::inertial in the units PreflightCheck works in.
+ */
+struct PreflightImu
+{
+    vex::inertial *imu;
+
+    bool installed() { return imu->installed(); }
+    bool isCalibrating() { return imu->isCalibrating(); }
+    double rotationDeg() { return imu->rotation(vex::rotationUnits::deg); }
+};
+
+using RobotPreflight = PreflightCheck<PreflightMotor, PreflightImu, PeriodicScheduler::Clock>;
+
+// Verdicts of the last runPreflight(), for showPreflightSummary().
+static std::vector<RobotPreflight::Result> preflightResults;
+static std::uint64_t preflightElapsedUs = 0;
+
+/**
+ * @brief Checks the drive motors and the IMU before the robot is used. Run after the gyro is
+ *        calibrated and before odometry starts, since the motor pulses move the robot slightly.
+ *
+ * A robot disabled by the field or a competition switch ignores spin(), so the motor pulses
+ * are skipped then and only the installed and temperature checks run.
+ *
+ * Every verdict is logged at Info, which never waits on the controller screen, and
+ * showPreflightSummary() puts them on the brain screen. The three-wire rear bumper is not
+ * checked: unplugged, it reads the same as released.
+ *
+ * @return true if every device passed.
+ */
+bool runPreflight()
+{
+    using Device = configManager::Device;
+
+    const bool disabledByField = (Competition.isFieldControl() || Competition.isCompetitionSwitch()) && !Competition.isEnabled();
+    RobotPreflight::Limits limits;
+    limits.pulseMotors = ConfigManager.getPreflightPulse() && !disabledByField;
+    if (disabledByField && ConfigManager.getPreflightPulse())
+    {
+        logHandler("preflight", "Robot disabled by the field; motor pulses skipped.", Log::Level::Info);
+    }
+
+    RobotPreflight check(PeriodicScheduler::systemClock(), limits);
+    for (Device device : DeviceRegistry::driveMotors)
+    {
+        check.addMotor(configManager::deviceName(device), PreflightMotor{&Devices.motor(device)});
+    }
+    check.addImu(configManager::deviceName(Device::Inertial), PreflightImu{&Devices.inertial()});
+
+    const bool passed = check.run();
+    preflightResults = check.getResults();
+    preflightElapsedUs = check.getElapsedUs();
+
+    for (const RobotPreflight::Result &result : preflightResults)
+    {
+        if (result.passed)
+        {
+            logHandler("preflight", std::format("{}: pass", result.name), Log::Level::Debug);
+        }
+        else
+        {
+            logHandler("preflight", std::format("{}: FAIL, {}", result.name, result.reason), Log::Level::Info);
+        }
+    }
+    logHandler("preflight", std::format("Pre-flight {} in {} ms.", passed ? "passed" : "FAILED", preflightElapsedUs / 1000), Log::Level::Info);
+    return passed;
+}
+
+/**
+ * @brief Draws the verdicts of the last runPreflight() in the lower half of the brain screen.
+ */
+void showPreflightSummary()
+{
+    if (preflightResults.empty())
+    {
+        return;
+    }
+    const bool passed = std::all_of(preflightResults.begin(), preflightResults.end(), [](const RobotPreflight::Result &result)
+                                    { return result.passed; });
+
+    Brain.Screen.setFont(vex::mono15);
+    Brain.Screen.setPenColor(passed ? vex::green : vex::red);
+    int y = 120;
+    Brain.Screen.printAt(5, y, true, "Pre-flight %s (%d ms)", passed ? "PASS" : "FAIL", static_cast<int>(preflightElapsedUs / 1000));
+    for (const RobotPreflight::Result &result : preflightResults)
+    {
+        y += 16;
+        Brain.Screen.setPenColor(result.passed ? vex::green : vex::red);
+        Brain.Screen.printAt(5, y, true, "%-16s %s %s", result.name.c_str(), result.passed ? "ok" : "FAIL", result.reason.c_str());
+    }
+    Brain.Screen.setPenColor(vex::white);
+}
@@ -2,55 +2,49 @@
 
 vex::brain Brain;
 
-int frontLeftPort = ConfigManager.getMotorPort("FRONT_LEFT_MOTOR");
-int rearLeftPort = ConfigManager.getMotorPort("REAR_LEFT_MOTOR");
-int frontRightPort = ConfigManager.getMotorPort("FRONT_RIGHT_MOTOR");
-int rearRightPort = ConfigManager.getMotorPort("REAR_RIGHT_MOTOR");
-
-vex::gearSetting frontLeftGearRatio = ConfigManager.getGearSetting(ConfigManager.getGearRatio("FRONT_LEFT_MOTOR"));
-vex::gearSetting rearLeftGearRatio = ConfigManager.getGearSetting(ConfigManager.getGearRatio("REAR_LEFT_MOTOR"));
-vex::gearSetting frontRightGearRatio = ConfigManager.getGearSetting(ConfigManager.getGearRatio("FRONT_RIGHT_MOTOR"));
-vex::gearSetting rearRightGearRatio = ConfigManager.getGearSetting(ConfigManager.getGearRatio("REAR_RIGHT_MOTOR"));
-
-bool frontLeftReversed = ConfigManager.getMotorReversed("FRONT_LEFT_MOTOR");
-bool rearLeftReversed = ConfigManager.getMotorReversed("REAR_LEFT_MOTOR");
-bool frontRightReversed = ConfigManager.getMotorReversed("FRONT_RIGHT_MOTOR");
-bool rearRightReversed = ConfigManager.getMotorReversed("REAR_RIGHT_MOTOR");
-
-vex::triport::port *bumperTriPort = ConfigManager.getTriPort("REAR_BUMPER"); // Thanks vex for making this with pointers! (sarcasm)
-
-vex::motor frontLeftMotor = vex::motor(frontLeftPort, frontLeftGearRatio, frontLeftReversed);
-vex::motor rearLeftMotor = vex::motor(rearLeftPort, rearLeftGearRatio, rearLeftReversed);
-vex::motor_group LeftDriveSmart = vex::motor_group(frontLeftMotor, rearLeftMotor);
-
-vex::motor frontRightMotor = vex::motor(frontRightPort, frontRightGearRatio, frontRightReversed);
-vex::motor rearRightMotor = vex::motor(rearRightPort, rearRightGearRatio, rearRightReversed);
-vex::motor_group RightDriveSmart = vex::motor_group(frontRightMotor, rearRightMotor);
-
-vex::inertial InertialGyro = vex::inertial(vex::PORT3);
-vex::smartdrive Drivetrain = vex::smartdrive(LeftDriveSmart, RightDriveSmart, InertialGyro, 319.19, 320, 165, vex::distanceUnits::mm, 1);
-
 vex::controller primaryController = vex::controller(vex::controllerType::primary);
 vex::controller partnerController = vex::controller(vex::controllerType::partner);
 
-vex::bumper RearBumper = vex::bumper(*bumperTriPort);
-
 vex::competition Competition;
+
+/**
+ * @brief Returns the forward distance sensor set by AEBDISTANCEPORT, or nullptr if none is configured.
+ *
+ * Created on first use, after the config has been parsed. Config ports are 1-based like the
+ * labels on the brain.
+ */
+vex::distance *getFrontDistanceSensor()
+{
+    static vex::distance *sensor = ConfigManager.getAebDistancePort() > 0
+                                       ? new vex::distance(ConfigManager.getAebDistancePort() - 1)
+                                       : nullptr;
+    return sensor;
+}
 /**
  * Check if the Y button is held at startup to enter diagnostic mode.
+ *
+ * Watches for Y held for one second, for at most two seconds and only while the robot is
+ * disabled. It reads the button state rather than ButtonService events: once the robot is
+ * enabled the drive mode menu is the event queue's only consumer.
  */
 bool isDiagnosticMode()
 {
-    auto buttonPressTimes = controllerButtonsPressed(primaryController);
-    if (buttonPressTimes.find("Y") != buttonPressTimes.end())
+    vex::timer windowTimer;
+    vex::timer holdTimer;
+    bool yWasDown = false;
+    while (!Competition.isEnabled() && windowTimer.time() < 2000)
     {
-        for (auto duration : buttonPressTimes["Y"])
+        const bool yDown = isPressed(readButtons(primaryController), ControllerButton::Y);
+        if (yDown && !yWasDown)
         {
-            if (duration >= 1000)
-            {
-                return true;
-            }
+            holdTimer.clear();
+        }
+        else if (yDown && holdTimer.time() >= 1000)
+        {
+            return true;
         }
+        yWasDown = yDown;
+        vex::this_thread::sleep_for(ConfigManager.getCtrlr1PollingRate());
     }
     return false;
 }
@@ -84,6 +78,7 @@ void vexCodeInit()
     primaryController.Screen.setCursor(1, 1);
     partnerController.Screen.clearScreen();
     partnerController.Screen.setCursor(1, 1);
+    showPreflightSummary();
 
     primaryController.Screen.print("Starting up...");
     partnerController.Screen.print("Starting up...");
@@ -0,0 +1,56 @@
+#include "vex.h"
+
+void AntiLockBraking::reset()
+{
+    estimator.reset();
+    slip.fill(0);
+    scale.fill(1);
+}
+
+/**
+ * @brief Reduces the braking voltage of each wheel that is locking up.
+ *
+ * @param command The per-wheel voltages to limit, modified in place.
+ * @param inputs Wheel velocities, IMU readings and tick length.
+ */
+void AntiLockBraking::apply(WheelVolts &command, const Inputs &inputs)
+{
+    estimator.update(inputs.wheelRpm, inputs.forwardAccelG, inputs.yawRateDps, inputs.dtSeconds);
+
+    for (std::size_t i = 0; i < WheelCount; ++i)
+    {
+        const double ground = estimator.getExpectedSpeed(i);
+        const bool braking = command.volts[i] * ground < 0 && std::abs(ground) >= settings.minSpeed;
+        if (!braking)
+        {
+            // Full braking is available again the next time the driver brakes.
+            slip[i] = 0;
+            scale[i] = 1;
+            continue;
+        }
+
+        // Wheel speed in the direction the ground moves, so a wheel spun backwards slips more than 1.
+        const double rolling = estimator.getWheelSpeed(i) * (ground > 0 ? 1.0 : -1.0);
+        slip[i] = std::max(0.0, 1.0 - rolling / std::abs(ground));
+
+        double targetScale = 1.0;
+        if (slip[i] > settings.targetSlip)
+        {
+            targetScale = std::max(settings.minScale, 1.0 - settings.slipGain * (slip[i] - settings.targetSlip));
+        }
+
+        // Release at once, reapply gradually so the wheel does not lock again straight away.
+        if (targetScale < scale[i])
+        {
+            scale[i] = targetScale;
+        }
+        else
+        {
+            scale[i] = std::min(targetScale, scale[i] + settings.reapplyPerSecond * inputs.dtSeconds);
+        }
+
+        // Scale the braking effort, not the voltage: at 0 V the motor still brakes on its back-EMF.
+        const double rollingVolts = 12.0 * ground / (settings.freeRpm / 60.0 * settings.estimator.wheelTravelMeters);
+        command.volts[i] = rollingVolts + scale[i] * (command.volts[i] - rollingVolts);
+    }
+}
@@ -0,0 +1,301 @@
+#include "vex.h"
+
+// Drive system flags
+bool tractionControlEnabled = true;
+bool stabilityControlEnabled = true;
+bool absEnabled = true;
+bool aebEnabled = true;
+bool powerGovernorEnabled = true;
+
+// Function to apply traction control
+static void applyTractionControl(TractionControl &tractionControl, WheelVolts &wheelVolts, const SensorFrame &frame, double dtSeconds)
+{
+    TractionControl::Inputs inputs;
+    for (std::size_t i = 0; i < WheelCount; ++i)
+    {
+        inputs.wheelRpm[i] = frame.wheels[i].velocityRpm;
+    }
+    inputs.forwardAccelG = frame.forwardAccelG;
+    inputs.yawRateDps = frame.yawRateDps;
+    inputs.dtSeconds = dtSeconds;
+
+    tractionControl.apply(wheelVolts, inputs);
+}
+
+/**
+ * @brief Returns the free speed in rpm of a V5 motor cartridge.
+ */
+static double maxRpmForGear(vex::gearSetting gear)
+{
+    switch (gear)
+    {
+    case vex::gearSetting::ratio6_1:
+        return 600;
+    case vex::gearSetting::ratio36_1:
+        return 100;
+    default:
+        return 200;
+    }
+}
+
+// Function to track side velocity targets with the closed-loop controllers
+static void applyVelocityControl(VelocityController &leftController, VelocityController &rightController, DriveCommand &command, const SensorFrame &frame, double maxRpm, double dtSeconds)
+{
+    double leftTarget = command.leftVolts() / 12.0 * maxRpm;
+    double rightTarget = command.rightVolts() / 12.0 * maxRpm;
+
+    double leftVolts = leftController.update(leftTarget, frame.leftVelocityRpm(), dtSeconds);
+    double rightVolts = rightController.update(rightTarget, frame.rightVelocityRpm(), dtSeconds);
+
+    command.forwardVolts = (leftVolts + rightVolts) / 2;
+    command.turnVolts = (leftVolts - rightVolts) / 2;
+}
+
+// Function to apply stability control
+static void applyStabilityControl(StabilityControl &stabilityControl, DriveCommand &command, const SensorFrame &frame, double dtSeconds)
+{
+    StabilityControl::Inputs inputs;
+    inputs.forwardVolts = command.forwardVolts;
+    inputs.turnVolts = command.turnVolts;
+    inputs.yawRateDps = frame.yawRateDps;
+    inputs.rotationDeg = frame.rotationDeg;
+    inputs.dtSeconds = dtSeconds;
+
+    command.turnVolts = stabilityControl.correctTurn(inputs);
+}
+
+// Function to apply ABS
+static void applyAntiLockBraking(AntiLockBraking &antiLockBraking, WheelVolts &wheelVolts, const SensorFrame &frame, double dtSeconds)
+{
+    AntiLockBraking::Inputs inputs;
+    for (std::size_t i = 0; i < WheelCount; ++i)
+    {
+        inputs.wheelRpm[i] = frame.wheels[i].velocityRpm;
+    }
+    inputs.forwardAccelG = frame.forwardAccelG;
+    inputs.yawRateDps = frame.yawRateDps;
+    inputs.dtSeconds = dtSeconds;
+
+    antiLockBraking.apply(wheelVolts, inputs);
+}
+
+// Function to keep the drivetrain current within budget
+static void applyPowerGovernor(PowerGovernor &powerGovernor, WheelVolts &wheelVolts, const SensorFrame &frame)
+{
+    std::array<double, WheelCount> measuredAmps;
+    for (std::size_t i = 0; i < WheelCount; ++i)
+    {
+        measuredAmps[i] = frame.wheels[i].currentAmps;
+    }
+
+    powerGovernor.apply(wheelVolts, measuredAmps);
+}
+
+// Function to apply emergency braking. Runs last so nothing can undo it within the tick.
+static void applyEmergencyBraking(EmergencyBraking &emergencyBraking, WheelVolts &wheelVolts, const SensorFrame &frame, double dtSeconds)
+{
+    EmergencyBraking::Inputs inputs;
+    inputs.forwardSpeed = frame.forwardSpeed();
+    inputs.obstacleDistance = frame.obstacleDistanceM;
+    inputs.forwardAccelG = frame.forwardAccelG;
+    inputs.collision = frame.collision;
+    inputs.rearContact = frame.rearBumperPressed;
+    inputs.dtSeconds = dtSeconds;
+
+    emergencyBraking.apply(wheelVolts, inputs);
+}
+
+static TractionControl::Settings tractionSettingsForRobot()
+{
+    TractionControl::Settings settings;
+    settings.wheelTravelMeters = wheelTravelMm / 1000.0;
+    settings.trackWidthMeters = trackWidthMm / 1000.0;
+    return settings;
+}
+
+static AntiLockBraking::Settings absSettingsForRobot()
+{
+    AntiLockBraking::Settings settings;
+    settings.estimator.wheelTravelMeters = wheelTravelMm / 1000.0;
+    settings.estimator.trackWidthMeters = trackWidthMm / 1000.0;
+    settings.freeRpm = maxRpmForGear(ConfigManager.getDeviceConfig(configManager::Device::FrontLeftMotor).gearSetting);
+    return settings;
+}
+
+static PowerGovernor::Settings powerSettingsFromConfig()
+{
+    PowerGovernor::Settings settings;
+    settings.budgetAmps = ConfigManager.getDriveCurrentBudget();
+    settings.priority = ConfigManager.getDrivePriority();
+    return settings;
+}
+
+static std::array<vex::motor *, WheelCount> driveMotorsFromRegistry()
+{
+    std::array<vex::motor *, WheelCount> motors;
+    for (std::size_t i = 0; i < WheelCount; ++i)
+    {
+        motors[i] = &Devices.motor(DeviceRegistry::driveMotors[i]);
+    }
+    return motors;
+}
+
+/**
+ * @brief Creates the drive pipeline from the loaded config.
+ *
+ * @param tickMs The period the caller will run tick() at.
+ */
+DriveSystem::DriveSystem(std::uint32_t tickMs)
+    : tickSeconds(tickMs / 1000.0),
+      tractionControl(tractionSettingsForRobot()),
+      antiLockBraking(absSettingsForRobot()),
+      powerGovernor(powerSettingsFromConfig()),
+      // Closed-loop output runs inside the drive tick, so it shares the scheduler's fixed rate.
+      velocityOutput(ConfigManager.getDriveOutput() == configManager::DriveOutput::Velocity),
+      maxDriveRpm(maxRpmForGear(ConfigManager.getDeviceConfig(configManager::Device::FrontLeftMotor).gearSetting)),
+      leftVelocityController(ConfigManager.getVelocityGains()),
+      rightVelocityController(ConfigManager.getVelocityGains()),
+      wheelOutputs(driveMotorsFromRegistry()),
+      motorGeneration(Devices.getGeneration())
+{
+    configure(ConfigManager.getDriveMode());
+}
+
+/**
+ * @brief Specializes the input pipeline for a drive mode. Call only when the mode changes.
+ */
+void DriveSystem::configure(configManager::DriveMode mode)
+{
+    inputPipeline.configure(mode, inputSettingsFromConfig());
+}
+
+/**
+ * @brief Picks up reloaded live settings: input curve, velocity gains, current budget and tick rate.
+ *
+ * Call between ticks, like configure(). Filter, controller and slew limiter state is kept, so
+ * the output carries on from where it was.
+ */
+void DriveSystem::reloadSettings(std::uint32_t tickMs)
+{
+    tickSeconds = tickMs / 1000.0;
+    inputPipeline.configure(inputPipeline.getDriveMode(), inputSettingsFromConfig());
+    powerGovernor.setSettings(powerSettingsFromConfig());
+    leftVelocityController.setGains(ConfigManager.getVelocityGains());
+    rightVelocityController.setGains(ConfigManager.getVelocityGains());
+}
+
+/**
+ * @brief Computes the wheel voltages for one control cycle without touching any device.
+ *
+ * @param frame The sensor readings and controller input for this cycle, live or recorded.
+ */
+WheelVolts DriveSystem::compute(const SensorFrame &frame)
+{
+    DriveCommand command = inputPipeline.process(frame.sticks, tickSeconds);
+    inputCommand = command;
+
+    // Apply stability control if enabled
+    if (stabilityControlEnabled)
+    {
+        applyStabilityControl(stabilityControl, command, frame, tickSeconds);
+    }
+
+    if (velocityOutput)
+    {
+        applyVelocityControl(leftVelocityController, rightVelocityController, command, frame, maxDriveRpm, tickSeconds);
+    }
+
+    WheelVolts wheelVolts = WheelVolts::fromSides(command.leftVolts(), command.rightVolts());
+
+    // Apply ABS if enabled
+    if (absEnabled)
+    {
+        applyAntiLockBraking(antiLockBraking, wheelVolts, frame, tickSeconds);
+    }
+
+    // Apply traction control if enabled
+    if (tractionControlEnabled)
+    {
+        applyTractionControl(tractionControl, wheelVolts, frame, tickSeconds);
+    }
+
+    // Apply the current budget if enabled
+    if (powerGovernorEnabled)
+    {
+        applyPowerGovernor(powerGovernor, wheelVolts, frame);
+    }
+
+    // Apply emergency braking if enabled
+    if (aebEnabled)
+    {
+        applyEmergencyBraking(emergencyBraking, wheelVolts, frame, tickSeconds);
+    }
+
+    return wheelVolts;
+}
+
+/**
+ * @brief Runs one drive control tick and writes the result to the motors.
+ *
+ * @param frame The sensor readings and controller input for this cycle, live or replayed.
+ */
+void DriveSystem::tick(const SensorFrame &frame)
+{
+    // A motor moved to another port is picked up here, without restarting the control loop.
+    if (const std::uint32_t generation = Devices.getGeneration(); generation != motorGeneration)
+    {
+        motorGeneration = generation;
+        for (std::size_t i = 0; i < WheelCount; ++i)
+        {
+            wheelOutputs.rebind(i, &Devices.motor(DeviceRegistry::driveMotors[i]));
+        }
+    }
+
+    const EmergencyBraking::State previousBraking = emergencyBraking.getState();
+    WheelVolts wheelVolts = compute(frame);
+    const EmergencyBraking::State braking = emergencyBraking.getState();
+
+    // Apply the calculated voltages to the motors, one write per changed motor. While
+    // braking, wheels not backing away are held in place instead of coasting at 0 V.
+    for (std::size_t i = 0; i < WheelCount; ++i)
+    {
+        if (braking == EmergencyBraking::State::Brake && wheelVolts.volts[i] >= 0)
+        {
+            wheelOutputs.hold(i);
+        }
+        else
+        {
+            wheelOutputs.set(i, wheelVolts.volts[i]);
+        }
+    }
+    wheelOutputs.flush(frame.timestampMs);
+
+    if (braking != previousBraking)
+    {
+        // Rumble only on escalation; the controller link is too slow to call every tick.
+        if (braking > previousBraking)
+        {
+            static constexpr const char *patterns[] = {"", ".", "..", "---"};
+            primaryController.rumble(patterns[static_cast<std::uint8_t>(braking)]);
+        }
+        logDeferred("DriveSystem::tick", std::format("Emergency braking: {} -> {} (time to impact {:.2f}s)", emergencyBrakingStateName(previousBraking), emergencyBrakingStateName(braking), emergencyBraking.getTimeToImpact()), Log::Level::Debug);
+    }
+}
+
+/**
+ * @brief Stops the drive motors and clears controller state.
+ */
+void DriveSystem::stop()
+{
+    wheelOutputs.setAll(WheelVolts{}.volts);
+    wheelOutputs.invalidate();
+    wheelOutputs.flush(vex::timer::system());
+    inputPipeline.reset();
+    tractionControl.reset();
+    antiLockBraking.reset();
+    stabilityControl.reset();
+    powerGovernor.reset();
+    emergencyBraking.reset();
+    leftVelocityController.reset();
+    rightVelocityController.reset();
+}
@@ -0,0 +1,121 @@
+#include "vex.h"
+
+static std::atomic<bool> collisionPending{false};
+
+void reportCollision()
+{
+    collisionPending.store(true, std::memory_order_release);
+}
+
+/**
+ * @brief Returns whether a collision was reported since the last call, and clears it.
+ */
+bool takeCollision()
+{
+    return collisionPending.exchange(false, std::memory_order_acq_rel);
+}
+
+const char *emergencyBrakingStateName(EmergencyBraking::State state)
+{
+    switch (state)
+    {
+    case EmergencyBraking::State::Warn:
+        return "Warn";
+    case EmergencyBraking::State::Limit:
+        return "Limit";
+    case EmergencyBraking::State::Brake:
+        return "Brake";
+    default:
+        return "Clear";
+    }
+}
+
+void EmergencyBraking::reset()
+{
+    state = State::Clear;
+    secondsInState = 0;
+    timeToImpact = -1;
+}
+
+/**
+ * @brief Maps a time to impact to a state, with every threshold raised by `margin`.
+ */
+EmergencyBraking::State EmergencyBraking::stateForTimeToImpact(double seconds, double margin) const
+{
+    if (seconds < 0)
+    {
+        return State::Clear;
+    }
+    if (seconds < settings.brakeSeconds + margin)
+    {
+        return State::Brake;
+    }
+    if (seconds < settings.limitSeconds + margin)
+    {
+        return State::Limit;
+    }
+    if (seconds < settings.warnSeconds + margin)
+    {
+        return State::Warn;
+    }
+    return State::Clear;
+}
+
+/**
+ * @brief Updates the braking state and overrides the wheel voltages for it.
+ *
+ * @param wheelVolts The drive command after every other stage. Modified in place.
+ * @param inputs Speed, obstacle and impact readings for this tick.
+ * @return The state in effect for this tick.
+ */
+EmergencyBraking::State EmergencyBraking::apply(WheelVolts &wheelVolts, const Inputs &inputs)
+{
+    secondsInState += inputs.dtSeconds;
+
+    const double closingSpeed = inputs.forwardSpeed;
+    timeToImpact = inputs.obstacleDistance >= 0 && closingSpeed > settings.minClosingSpeed
+                       ? inputs.obstacleDistance / closingSpeed
+                       : -1;
+
+    const bool impact = inputs.collision ||
+                        (inputs.forwardAccelG <= -settings.impactDecelG && inputs.forwardSpeed > settings.minClosingSpeed);
+
+    // Stopped in front of the obstacle there is no time to impact, but releasing would let the
+    // robot creep forward and brake again. Hold until it backs away or the obstacle is gone.
+    const bool stoppedAtObstacle = inputs.obstacleDistance >= 0 && std::abs(inputs.forwardSpeed) <= settings.minClosingSpeed;
+
+    State target = impact ? State::Brake : stateForTimeToImpact(timeToImpact, 0);
+    if (target > state)
+    {
+        state = target;
+        secondsInState = 0;
+    }
+    else if (state != State::Clear && !stoppedAtObstacle && secondsInState >= settings.minHoldSeconds &&
+             stateForTimeToImpact(timeToImpact, settings.hysteresisSeconds) < state)
+    {
+        // Step down one level at a time so the driver gets power back gradually.
+        state = static_cast<State>(static_cast<std::uint8_t>(state) - 1);
+        secondsInState = 0;
+    }
+
+    for (std::size_t i = 0; i < WheelCount; ++i)
+    {
+        double &volts = wheelVolts.volts[i];
+        if (state == State::Brake)
+        {
+            // Backing away from the obstacle is still allowed.
+            volts = std::min(volts, 0.0);
+        }
+        else if (state == State::Limit)
+        {
+            volts = std::min(volts, settings.limitVolts);
+        }
+
+        if (inputs.rearContact)
+        {
+            // Already touching something behind: no further reverse.
+            volts = std::max(volts, 0.0);
+        }
+    }
+    return state;
+}
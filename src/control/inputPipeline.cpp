@@ -0,0 +1,95 @@
+#include "vex.h"
+
+/**
+ * @brief Reads all four axes of a controller once.
+ */
+StickSample readSticks(const vex::controller &controller)
+{
+    return StickSample{{controller.Axis1.position(),
+                        controller.Axis2.position(),
+                        controller.Axis3.position(),
+                        controller.Axis4.position()}};
+}
+
+/**
+ * @brief Builds the pipeline settings from the values loaded by configManager.
+ */
+InputPipeline::Settings inputSettingsFromConfig()
+{
+    InputPipeline::Settings settings;
+    settings.leftDeadzone = ConfigManager.getLeftDeadzone();
+    settings.rightDeadzone = ConfigManager.getRightDeadzone();
+    settings.expo = ConfigManager.getInputExpo();
+    settings.slewVoltsPerSecond = ConfigManager.getSlewRate();
+    return settings;
+}
+
+InputPipeline::InputPipeline()
+{
+    configure(configManager::DriveMode::SplitArcade, Settings{});
+}
+
+/**
+ * @brief Rebuilds the lookup tables and selects the processing function for a drive mode.
+ *
+ * Call this when the drive mode or the input settings change, not every tick. The slew
+ * limiters keep their last output, so a reload or mode change mid-drive does not snap the
+ * command to 0 V and ramp it back up.
+ *
+ * @param mode The drive mode to specialize for.
+ * @param settings Deadzones, curve, slew rate and voltage range.
+ */
+void InputPipeline::configure(configManager::DriveMode mode, const Settings &settings)
+{
+    this->mode = mode;
+
+    primaryTable.build(StageChain<Deadzone, ExpoCurve, VoltageScale>{{Deadzone{settings.leftDeadzone}, ExpoCurve{settings.expo}, VoltageScale{settings.maxVolts}}});
+    secondaryTable.build(StageChain<Deadzone, ExpoCurve, VoltageScale>{{Deadzone{settings.rightDeadzone}, ExpoCurve{settings.expo}, VoltageScale{settings.maxVolts}}});
+
+    primarySlew.setRate(settings.slewVoltsPerSecond);
+    secondarySlew.setRate(settings.slewVoltsPerSecond);
+
+    switch (mode)
+    {
+    case configManager::DriveMode::LeftArcade:
+        processFunction = &processMode<configManager::DriveMode::LeftArcade>;
+        break;
+    case configManager::DriveMode::RightArcade:
+        processFunction = &processMode<configManager::DriveMode::RightArcade>;
+        break;
+    case configManager::DriveMode::SplitArcade:
+        processFunction = &processMode<configManager::DriveMode::SplitArcade>;
+        break;
+    case configManager::DriveMode::Tank:
+        processFunction = &processMode<configManager::DriveMode::Tank>;
+        break;
+    }
+}
+
+/**
+ * @brief Restarts the slew limiters from 0 V, e.g. after the drive was stopped.
+ */
+void InputPipeline::reset()
+{
+    primarySlew.reset();
+    secondarySlew.reset();
+}
+
+template <configManager::DriveMode Mode>
+DriveCommand InputPipeline::processMode(InputPipeline &pipeline, const StickSample &sample, double dtSeconds)
+{
+    using Axes = DriveModeAxes<Mode>;
+
+    double primary = pipeline.primarySlew(pipeline.primaryTable.lookup(sample.axes[Axes::primary]), dtSeconds);
+    double secondary = pipeline.secondarySlew(pipeline.secondaryTable.lookup(sample.axes[Axes::secondary]), dtSeconds);
+
+    if constexpr (Axes::tank)
+    {
+        // Left/right sticks expressed as forward/turn so every mode shares one output path.
+        return DriveCommand{(primary + secondary) / 2, (primary - secondary) / 2};
+    }
+    else
+    {
+        return DriveCommand{primary, secondary};
+    }
+}
@@ -0,0 +1,231 @@
+#include "vex.h"
+#include <fstream>
+
+constexpr std::uint32_t replayMagic = 0x594C5052; // "RPLY"
+constexpr std::uint32_t replayFormatVersion = 1;
+
+constexpr std::uint8_t buttonsChangedBit = 1 << 4;
+constexpr std::uint8_t driveModeChangedBit = 1 << 5;
+
+/**
+ * @struct ReplayFileHeader
+ * @brief Header written before the records of a replay file.
+ */
+struct ReplayFileHeader
+{
+    std::uint32_t magic;
+    std::uint32_t formatVersion;
+    std::uint32_t tickMs;
+    std::uint32_t driveMode;
+    std::uint32_t sampleCount;
+};
+
+InputRecorder::InputRecorder(std::uint32_t tickMs, configManager::DriveMode driveMode, std::size_t maxSamples)
+    : tickMs(tickMs), startMode(driveMode), currentMode(driveMode), maxSamples(maxSamples)
+{
+    data.reserve(maxSamples * 2);
+}
+
+/**
+ * @brief Appends one tick.
+ *
+ * @param sample The controller state for this tick.
+ * @param driveMode The drive mode in effect, so mode changes replay at the same tick.
+ * @return false once the recording is full.
+ */
+bool InputRecorder::record(const ControllerSample &sample, configManager::DriveMode driveMode)
+{
+    if (sampleCount >= maxSamples)
+    {
+        return false;
+    }
+
+    std::uint8_t mask = 0;
+    for (std::size_t axis = 0; axis < sample.sticks.axes.size(); ++axis)
+    {
+        if (sampleCount == 0 || sample.sticks.axes[axis] != previous.sticks.axes[axis])
+        {
+            mask |= static_cast<std::uint8_t>(1u << axis);
+        }
+    }
+    if (sampleCount == 0 || sample.buttons != previous.buttons)
+    {
+        mask |= buttonsChangedBit;
+    }
+    if (driveMode != currentMode)
+    {
+        mask |= driveModeChangedBit;
+    }
+
+    data.push_back(mask);
+    for (std::size_t axis = 0; axis < sample.sticks.axes.size(); ++axis)
+    {
+        if (mask & (1u << axis))
+        {
+            data.push_back(static_cast<std::uint8_t>(static_cast<std::int8_t>(sample.sticks.axes[axis])));
+        }
+    }
+    if (mask & buttonsChangedBit)
+    {
+        data.push_back(static_cast<std::uint8_t>(sample.buttons & 0xFF));
+        data.push_back(static_cast<std::uint8_t>(sample.buttons >> 8));
+    }
+    if (mask & driveModeChangedBit)
+    {
+        data.push_back(static_cast<std::uint8_t>(driveMode));
+        currentMode = driveMode;
+    }
+
+    previous = sample;
+    ++sampleCount;
+    return true;
+}
+
+/**
+ * @brief Writes the recording to a file in one pass.
+ */
+bool InputRecorder::save(const std::string &fileName) const
+{
+    std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        logHandler("InputRecorder::save", std::format("Could not open {} for writing.", fileName), Log::Level::Warn, 2);
+        return false;
+    }
+    ReplayFileHeader header{replayMagic, replayFormatVersion, tickMs, static_cast<std::uint32_t>(startMode), static_cast<std::uint32_t>(sampleCount)};
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char *>(data.data()), data.size());
+    return static_cast<bool>(file);
+}
+
+/**
+ * @brief Loads a replay file into memory.
+ *
+ * @return false if the file is missing, has the wrong format or is empty.
+ */
+bool InputReplayer::load(const std::string &fileName)
+{
+    std::ifstream file(fileName, std::ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+
+    ReplayFileHeader header{};
+    if (!file.read(reinterpret_cast<char *>(&header), sizeof(header)) ||
+        header.magic != replayMagic || header.formatVersion != replayFormatVersion || header.tickMs == 0)
+    {
+        logHandler("InputReplayer::load", std::format("{} is not a valid replay file.", fileName), Log::Level::Warn, 2);
+        return false;
+    }
+
+    data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    tickMs = header.tickMs;
+    startMode = currentMode = static_cast<configManager::DriveMode>(header.driveMode);
+    sampleCount = header.sampleCount;
+    samplesRead = 0;
+    offset = 0;
+    current = ControllerSample{};
+    return sampleCount > 0;
+}
+
+/**
+ * @brief Decodes the next tick.
+ *
+ * @param sample Receives the controller state.
+ * @param driveMode Receives the drive mode in effect for this tick.
+ * @return false at the end of the recording or if the data is truncated.
+ */
+bool InputReplayer::next(ControllerSample &sample, configManager::DriveMode &driveMode)
+{
+    if (samplesRead >= sampleCount || offset >= data.size())
+    {
+        return false;
+    }
+
+    std::uint8_t mask = data[offset++];
+    for (std::size_t axis = 0; axis < current.sticks.axes.size(); ++axis)
+    {
+        if (mask & (1u << axis))
+        {
+            if (offset >= data.size())
+            {
+                return false;
+            }
+            current.sticks.axes[axis] = static_cast<std::int8_t>(data[offset++]);
+        }
+    }
+    if (mask & buttonsChangedBit)
+    {
+        if (offset + 1 >= data.size())
+        {
+            return false;
+        }
+        current.buttons = static_cast<std::uint16_t>(data[offset] | (data[offset + 1] << 8));
+        offset += 2;
+    }
+    if (mask & driveModeChangedBit)
+    {
+        if (offset >= data.size())
+        {
+            return false;
+        }
+        currentMode = static_cast<configManager::DriveMode>(data[offset++]);
+    }
+
+    ++samplesRead;
+    sample = current;
+    driveMode = currentMode;
+    return true;
+}
+
+/**
+ * @brief Replays a recorded driver run through the drive pipeline.
+ *
+ * Runs at the recorded tick period on the periodic scheduler and stops the drive at the
+ * end of the recording or when `keepRunning` returns false.
+ *
+ * @param fileName The replay file on the SD card.
+ * @param keepRunning Checked every tick, e.g. while autonomous is active.
+ * @return true if the whole recording was replayed.
+ */
+bool replayRecording(const std::string &fileName, const std::function<bool()> &keepRunning)
+{
+    InputReplayer replayer;
+    if (!replayer.load(fileName))
+    {
+        logHandler("replayRecording", std::format("Could not load replay {}.", fileName), Log::Level::Error, 2);
+        return false;
+    }
+
+    DriveSystem drive(replayer.getTickMs());
+    drive.configure(replayer.getDriveMode());
+
+    bool finished = false;
+    PeriodicScheduler scheduler;
+    scheduler.addTask("replay", replayer.getTickMs(), 0, [&]()
+                      {
+                          ControllerSample sample;
+                          configManager::DriveMode mode;
+                          if (!replayer.next(sample, mode))
+                          {
+                              finished = true;
+                              return;
+                          }
+                          if (mode != drive.getDriveMode())
+                          {
+                              drive.configure(mode);
+                          }
+                          // Live sensors, recorded driver input.
+                          SensorFrame frame = readSensorFrame(primaryController);
+                          frame.sticks = sample.sticks;
+                          frame.buttons = sample.buttons;
+                          drive.tick(frame);
+                      });
+    scheduler.run([&]()
+                  { return !finished && keepRunning(); });
+
+    drive.stop();
+    logHandler("replayRecording", std::format("Replayed {} ticks at {} ms.", replayer.getSampleCount(), replayer.getTickMs()), Log::Level::Info);
+    return finished;
+}
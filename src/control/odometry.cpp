@@ -0,0 +1,104 @@
+#include "vex.h"
+
+Odometry DriveOdometry;
+
+/**
+ * @brief Requests a new current pose. Safe from any thread.
+ *
+ * The pose is applied, and the encoder and IMU baselines taken, at the start of the next
+ * update(); getPose() returns the old pose until then. isResetPending() tells when it has
+ * been applied.
+ */
+void Odometry::reset(const Pose &pose)
+{
+    // Writers of the request take turns, so requestedPose keeps a single writer at a time.
+    resetMutex.lock();
+    requestedPose.write(pose);
+    resetPending.store(true, std::memory_order_release);
+    resetMutex.unlock();
+}
+
+/**
+ * @brief Integrates one step of motion.
+ *
+ * @param leftRevs Cumulative left wheel revolutions.
+ * @param rightRevs Cumulative right wheel revolutions.
+ * @param imuHeadingRad Continuous IMU heading, counter-clockwise positive.
+ * @param dtSeconds Time since the previous update.
+ * @param timestampMs Time stamp stored with the published pose.
+ */
+void Odometry::update(double leftRevs, double rightRevs, double imuHeadingRad, double dtSeconds, std::uint32_t timestampMs)
+{
+    // Cleared before reading, so a request posted meanwhile is applied again next time, not lost.
+    if (resetPending.exchange(false, std::memory_order_acq_rel))
+    {
+        state = requestedPose.read();
+        initialized = false;
+    }
+
+    if (!initialized)
+    {
+        lastLeftRevs = leftRevs;
+        lastRightRevs = rightRevs;
+        lastImuHeading = imuHeadingRad;
+        initialized = true;
+        state.timestampMs = timestampMs;
+        published.write(state);
+        return;
+    }
+
+    double left = (leftRevs - lastLeftRevs) * settings.wheelTravelMeters;
+    double right = (rightRevs - lastRightRevs) * settings.wheelTravelMeters;
+    lastLeftRevs = leftRevs;
+    lastRightRevs = rightRevs;
+
+    double deltaTheta = settings.useImuHeading ? imuHeadingRad - lastImuHeading : (right - left) / settings.trackWidthMeters;
+    lastImuHeading = imuHeadingRad;
+
+    double arc = (left + right) / 2;
+
+    // Chord of the arc, pointing along the mid-step heading.
+    double chord = arc;
+    if (std::abs(deltaTheta) > 1e-9)
+    {
+        chord = 2 * (arc / deltaTheta) * std::sin(deltaTheta / 2);
+    }
+    double midHeading = state.theta + deltaTheta / 2;
+
+    state.x += chord * std::cos(midHeading);
+    state.y += chord * std::sin(midHeading);
+    state.theta += deltaTheta;
+    state.velocity = dtSeconds > 0 ? arc / dtSeconds : 0;
+    state.timestampMs = timestampMs;
+
+    published.write(state);
+}
+
+/**
+ * @brief Odometry task. Integrates the drive encoders and IMU heading at 100 Hz.
+ *
+ * Runs on its own thread for the whole program so the pose is available to both
+ * autonomous and driver control.
+ */
+void odometryTask()
+{
+    constexpr std::uint32_t periodMs = 10;
+
+    using Device = configManager::Device;
+    auto averageRevs = [](Device front, Device rear)
+    {
+        return (Devices.motor(front).position(vex::rotationUnits::rev) + Devices.motor(rear).position(vex::rotationUnits::rev)) / 2;
+    };
+
+    PeriodicScheduler scheduler;
+    scheduler.addTask("odometry", periodMs, 0, [&]()
+                      {
+                          // The IMU is clockwise positive; the pose is counter-clockwise positive.
+                          double heading = -Devices.inertial().rotation(vex::rotationUnits::deg) * M_PI / 180.0;
+                          DriveOdometry.update(averageRevs(Device::FrontLeftMotor, Device::RearLeftMotor),
+                                               averageRevs(Device::FrontRightMotor, Device::RearRightMotor),
+                                               heading, periodMs / 1000.0, vex::timer::system());
+                      });
+    scheduler.run([]()
+                  { return true; });
+}
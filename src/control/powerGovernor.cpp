@@ -0,0 +1,76 @@
+#include "vex.h"
+
+void PowerGovernor::reset()
+{
+    ampsPerVolt.fill(settings.initialAmpsPerVolt);
+    lastVolts.fill(0);
+    totalAmps = 0;
+    scale = 1;
+}
+
+double PowerGovernor::predictAmps(const WheelVolts &wheelVolts) const
+{
+    double amps = 0;
+    for (std::size_t i = 0; i < WheelCount; ++i)
+    {
+        amps += ampsPerVolt[i] * std::abs(wheelVolts.volts[i]);
+    }
+    return amps;
+}
+
+/**
+ * @brief Scales the wheel voltages so the predicted drivetrain current fits the budget.
+ *
+ * @param wheelVolts The drive command. Modified in place.
+ * @param measuredAmps This tick's current reading of each motor, Wheel order.
+ */
+void PowerGovernor::apply(WheelVolts &wheelVolts, const std::array<double, WheelCount> &measuredAmps)
+{
+    totalAmps = 0;
+    for (std::size_t i = 0; i < WheelCount; ++i)
+    {
+        totalAmps += measuredAmps[i];
+        if (std::abs(lastVolts[i]) >= settings.minLearnVolts)
+        {
+            double reading = measuredAmps[i] / std::abs(lastVolts[i]);
+            ampsPerVolt[i] += settings.filterWeight * (reading - ampsPerVolt[i]);
+        }
+    }
+
+    // Forward and turn parts of each side; wheels on the same side share them.
+    WheelVolts primary;
+    WheelVolts secondary;
+    for (std::size_t i = 0; i < WheelCount; ++i)
+    {
+        std::size_t mirror = isLeftWheel(i) ? i + 2 : i - 2;
+        double forward = (wheelVolts.volts[i] + wheelVolts.volts[mirror]) / 2;
+        double turn = wheelVolts.volts[i] - forward;
+        primary.volts[i] = settings.priority == configManager::DrivePriority::Turn ? turn : forward;
+        secondary.volts[i] = settings.priority == configManager::DrivePriority::Turn ? forward : turn;
+    }
+
+    const double fullAmps = predictAmps(wheelVolts);
+    scale = 1;
+    if (fullAmps > settings.budgetAmps)
+    {
+        const double primaryAmps = predictAmps(primary);
+        double primaryScale = 1;
+        double secondaryScale = 0;
+        if (primaryAmps >= settings.budgetAmps)
+        {
+            primaryScale = settings.budgetAmps / primaryAmps;
+        }
+        else
+        {
+            // Predicted current is close to linear in the secondary scale between the two ends.
+            secondaryScale = (settings.budgetAmps - primaryAmps) / (fullAmps - primaryAmps);
+        }
+        for (std::size_t i = 0; i < WheelCount; ++i)
+        {
+            wheelVolts.volts[i] = primary.volts[i] * primaryScale + secondary.volts[i] * secondaryScale;
+        }
+        scale = settings.budgetAmps / fullAmps;
+    }
+
+    lastVolts = wheelVolts.volts;
+}
@@ -0,0 +1,148 @@
+#include "vex.h"
+
+/**
+ * @brief Computes side velocities that steer the robot back onto the trajectory.
+ *
+ * @param pose The current odometry pose.
+ * @param trajectory The trajectory being followed.
+ * @return Left/right wheel velocities, the signed cross-track error and whether the end was reached.
+ */
+PurePursuit::Output PurePursuit::update(const Pose &pose, const Trajectory &trajectory)
+{
+    Output output;
+    const auto &samples = trajectory.getSamples();
+    if (samples.empty())
+    {
+        output.finished = true;
+        return output;
+    }
+
+    auto distanceTo = [&pose](const TrajectorySample &sample)
+    {
+        return std::hypot(sample.x - pose.x, sample.y - pose.y);
+    };
+
+    // The closest sample only moves forward, so a bounded search window is enough.
+    std::size_t searchEnd = std::min(samples.size(), closestIndex + settings.searchWindow);
+    double closestDistance = distanceTo(samples[closestIndex]);
+    for (std::size_t i = closestIndex + 1; i < searchEnd; ++i)
+    {
+        double distance = distanceTo(samples[i]);
+        if (distance < closestDistance)
+        {
+            closestDistance = distance;
+            closestIndex = i;
+        }
+    }
+
+    const TrajectorySample &closest = samples[closestIndex];
+    output.crossTrackError = -std::sin(closest.heading) * (pose.x - closest.x) + std::cos(closest.heading) * (pose.y - closest.y);
+
+    if (closestIndex == samples.size() - 1 && closestDistance <= settings.endToleranceMeters)
+    {
+        output.finished = true;
+        return output;
+    }
+
+    std::size_t lookaheadIndex = closestIndex;
+    while (lookaheadIndex + 1 < samples.size() && distanceTo(samples[lookaheadIndex]) < settings.lookaheadMeters)
+    {
+        ++lookaheadIndex;
+    }
+    const TrajectorySample &target = samples[lookaheadIndex];
+
+    // Lookahead point in the robot frame; curvature of the arc that reaches it.
+    double dx = target.x - pose.x;
+    double dy = target.y - pose.y;
+    double localY = -std::sin(pose.theta) * dx + std::cos(pose.theta) * dy;
+    double distanceSquared = dx * dx + dy * dy;
+    double curvature = distanceSquared > 1e-9 ? 2 * localY / distanceSquared : 0;
+
+    double velocity = std::max(static_cast<double>(closest.velocity), settings.minVelocity);
+    output.leftVelocity = velocity * (1 - curvature * settings.trackWidthMeters / 2);
+    output.rightVelocity = velocity * (1 + curvature * settings.trackWidthMeters / 2);
+    return output;
+}
+
+/**
+ * @brief Drives a trajectory with pure pursuit and the drive velocity loops.
+ *
+ * Resets the odometry to the first sample, then runs the follower at 100 Hz until the end
+ * is reached, `keepRunning` returns false or the trajectory duration plus two seconds has
+ * passed. Cross-track error statistics are logged and returned.
+ *
+ * @param trajectory A precomputed trajectory. Nothing is generated here.
+ * @param keepRunning Checked every tick, e.g. Competition.isAutonomous().
+ */
+FollowResult followTrajectory(const Trajectory &trajectory, const std::function<bool()> &keepRunning)
+{
+    constexpr std::uint32_t periodMs = 10;
+    const double dtSeconds = periodMs / 1000.0;
+    const double rpmPerMeterPerSecond = 60.0 / (wheelTravelMm / 1000.0);
+
+    FollowResult result;
+    if (!trajectory.isReady())
+    {
+        logHandler("followTrajectory", "Trajectory is not ready.", Log::Level::Error, 2);
+        return result;
+    }
+
+    const TrajectorySample &start = trajectory.getSamples().front();
+    Pose startPose;
+    startPose.x = start.x;
+    startPose.y = start.y;
+    startPose.theta = start.heading;
+    DriveOdometry.reset(startPose);
+
+    // The odometry task applies the reset on its next update; following from the old pose would
+    // steer towards the wrong place for the first tick.
+    for (std::uint32_t waitedMs = 0; DriveOdometry.isResetPending(); waitedMs += periodMs)
+    {
+        if (waitedMs >= 10 * periodMs)
+        {
+            logDeferred("followTrajectory", "Odometry did not apply the start pose, is odometryTask running?", Log::Level::Warn, 2);
+            break;
+        }
+        vex::this_thread::sleep_for(periodMs);
+    }
+
+    PurePursuit follower;
+    VelocityController leftController(ConfigManager.getVelocityGains());
+    VelocityController rightController(ConfigManager.getVelocityGains());
+
+    const double timeoutSeconds = trajectory.getDuration() + 2.0;
+    double errorSum = 0;
+    std::uint32_t ticks = 0;
+    bool done = false;
+
+    PeriodicScheduler scheduler;
+    scheduler.addTask("followTrajectory", periodMs, 0, [&]()
+                      {
+                          PurePursuit::Output output = follower.update(DriveOdometry.getPose(), trajectory);
+                          ++ticks;
+                          errorSum += std::abs(output.crossTrackError);
+                          result.maxCrossTrackError = std::max(result.maxCrossTrackError, std::abs(output.crossTrackError));
+
+                          if (output.finished || ticks * dtSeconds > timeoutSeconds)
+                          {
+                              result.completed = output.finished;
+                              done = true;
+                              return;
+                          }
+
+                          double leftVolts = leftController.update(output.leftVelocity * rpmPerMeterPerSecond, Devices.sideVelocityRpm(DeviceRegistry::Side::Left), dtSeconds);
+                          double rightVolts = rightController.update(output.rightVelocity * rpmPerMeterPerSecond, Devices.sideVelocityRpm(DeviceRegistry::Side::Right), dtSeconds);
+                          Devices.spinSide(DeviceRegistry::Side::Left, leftVolts);
+                          Devices.spinSide(DeviceRegistry::Side::Right, rightVolts);
+                      });
+    scheduler.run([&]()
+                  { return !done && keepRunning(); });
+
+    Devices.stopSide(DeviceRegistry::Side::Left, vex::brakeType::brake);
+    Devices.stopSide(DeviceRegistry::Side::Right, vex::brakeType::brake);
+
+    result.elapsedSeconds = ticks * dtSeconds;
+    result.meanCrossTrackError = ticks ? errorSum / ticks : 0;
+    logHandler("followTrajectory", std::format("Completed: {} | Time: {:.2f}s | Cross-track error mean/max: {:.3f}/{:.3f} m", result.completed, result.elapsedSeconds, result.meanCrossTrackError, result.maxCrossTrackError), Log::Level::Info);
+    return result;
+}
@@ -0,0 +1,177 @@
+#include "vex.h"
+
+static std::uint64_t vexNow()
+{
+    return vex::timer::systemHighResolution();
+}
+
+/**
+ * @brief Sleeps until an absolute deadline on the brain's high resolution clock.
+ *
+ * The RTOS sleep only has millisecond resolution, so the whole milliseconds are slept
+ * and the remainder is spent yielding to other threads.
+ */
+static void vexSleepUntil(std::uint64_t deadline)
+{
+    std::uint64_t now = vexNow();
+    if (deadline > now + 1000)
+    {
+        vex::this_thread::sleep_for(static_cast<std::uint32_t>((deadline - now) / 1000));
+    }
+    while (vexNow() < deadline)
+    {
+        vex::this_thread::yield();
+    }
+}
+
+/**
+ * @brief Returns the clock backed by the V5 brain's microsecond system timer.
+ */
+const PeriodicScheduler::Clock &PeriodicScheduler::systemClock()
+{
+    static const Clock clock{vexNow, vexSleepUntil};
+    return clock;
+}
+
+PeriodicScheduler::PeriodicScheduler(const Clock &clock)
+    : clock(clock)
+{
+}
+
+/**
+ * @brief Registers a task to run every `periodMs` milliseconds.
+ *
+ * @param name Name used when logging statistics.
+ * @param periodMs Task period in milliseconds. A period of 0 is clamped to 1.
+ * @param phaseMs Offset of the first deadline from the scheduler start, used to spread tasks
+ *                with the same period over different ticks.
+ * @param function Work to run at each deadline.
+ * @return The task id, used with getStats() and setPeriod().
+ */
+std::size_t PeriodicScheduler::addTask(const std::string &name, std::uint32_t periodMs, std::uint32_t phaseMs, TaskFunction function)
+{
+    Task task;
+    task.name = name;
+    task.periodUs = static_cast<std::uint64_t>(std::max<std::uint32_t>(periodMs, 1)) * 1000;
+    task.phaseUs = static_cast<std::uint64_t>(phaseMs) * 1000;
+    task.nextDeadlineUs = started ? clock.now() + task.phaseUs : task.phaseUs;
+    task.function = std::move(function);
+    tasks.push_back(std::move(task));
+    return tasks.size() - 1;
+}
+
+/**
+ * @brief Changes the period of a task. Takes effect after its next run.
+ */
+void PeriodicScheduler::setPeriod(std::size_t taskId, std::uint32_t periodMs)
+{
+    tasks[taskId].periodUs = static_cast<std::uint64_t>(std::max<std::uint32_t>(periodMs, 1)) * 1000;
+}
+
+void PeriodicScheduler::start()
+{
+    std::uint64_t now = clock.now();
+    for (auto &task : tasks)
+    {
+        task.nextDeadlineUs = now + task.phaseUs;
+    }
+    started = true;
+}
+
+/**
+ * @brief Sleeps until the earliest task deadline and runs every task that is due.
+ *
+ * After a task runs, its next deadline advances by exactly one period. If the task has
+ * already missed that deadline it is counted as an overrun and runs again straight away,
+ * so a short stall is caught up and the task keeps its rate over time. Only a task more than
+ * maxCatchUpPeriods behind skips the excess whole periods instead of bursting through them.
+ */
+void PeriodicScheduler::runOnce()
+{
+    if (tasks.empty())
+    {
+        return;
+    }
+    if (!started)
+    {
+        start();
+    }
+
+    std::uint64_t earliest = tasks[0].nextDeadlineUs;
+    for (const auto &task : tasks)
+    {
+        earliest = std::min(earliest, task.nextDeadlineUs);
+    }
+    if (clock.now() < earliest)
+    {
+        clock.sleepUntil(earliest);
+    }
+
+    for (auto &task : tasks)
+    {
+        std::uint64_t startTime = clock.now();
+        if (startTime < task.nextDeadlineUs)
+        {
+            continue;
+        }
+
+        std::uint64_t jitter = startTime - task.nextDeadlineUs;
+        task.function();
+        std::uint64_t endTime = clock.now();
+
+        TaskStats &stats = task.stats;
+        ++stats.runs;
+        stats.totalJitterUs += jitter;
+        stats.maxJitterUs = std::max(stats.maxJitterUs, jitter);
+        stats.maxRuntimeUs = std::max(stats.maxRuntimeUs, endTime - startTime);
+
+        task.nextDeadlineUs += task.periodUs;
+        if (endTime >= task.nextDeadlineUs)
+        {
+            ++stats.overruns;
+            const std::uint64_t behindUs = endTime - task.nextDeadlineUs;
+            const std::uint64_t catchUpUs = maxCatchUpPeriods * task.periodUs;
+            if (behindUs >= catchUpUs)
+            {
+                std::uint64_t missed = (behindUs - catchUpUs) / task.periodUs + 1;
+                stats.skippedPeriods += static_cast<std::uint32_t>(missed);
+                task.nextDeadlineUs += missed * task.periodUs;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Runs the scheduler until `keepRunning` returns false.
+ *
+ * @param keepRunning Checked before every scheduling step, e.g. Competition.isEnabled().
+ */
+void PeriodicScheduler::run(const std::function<bool()> &keepRunning)
+{
+    while (keepRunning())
+    {
+        runOnce();
+    }
+}
+
+void PeriodicScheduler::resetStats()
+{
+    for (auto &task : tasks)
+    {
+        task.stats = TaskStats{};
+    }
+}
+
+/**
+ * @brief Logs run count, jitter and overrun statistics for every task at Debug level.
+ *
+ * Goes through logDeferred(), so it can be called from one of the scheduler's own tasks.
+ */
+void PeriodicScheduler::logStats() const
+{
+    for (const auto &task : tasks)
+    {
+        const TaskStats &stats = task.stats;
+        logDeferred("PeriodicScheduler", std::format("{}: runs={} overruns={} skipped={} jitter(avg/max)={}/{}us runtime(max)={}us", task.name, stats.runs, stats.overruns, stats.skippedPeriods, stats.meanJitterUs(), stats.maxJitterUs, stats.maxRuntimeUs), Log::Level::Debug);
+    }
+}
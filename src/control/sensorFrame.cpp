@@ -0,0 +1,58 @@
+#include "vex.h"
+
+/**
+ * @brief Reads all 12 buttons of a controller into a bitmask.
+ */
+std::uint16_t readButtons(const vex::controller &controller)
+{
+    const vex::controller::button *buttons[] = {
+        &controller.ButtonA, &controller.ButtonB, &controller.ButtonX, &controller.ButtonY,
+        &controller.ButtonUp, &controller.ButtonDown, &controller.ButtonLeft, &controller.ButtonRight,
+        &controller.ButtonL1, &controller.ButtonL2, &controller.ButtonR1, &controller.ButtonR2};
+
+    std::uint16_t mask = 0;
+    for (std::size_t i = 0; i < std::size(buttons); ++i)
+    {
+        if (buttons[i]->pressing())
+        {
+            mask |= static_cast<std::uint16_t>(1u << i);
+        }
+    }
+    return mask;
+}
+
+static MotorSample readMotor(vex::motor &motor)
+{
+    return MotorSample{motor.velocity(vex::velocityUnits::rpm),
+                       motor.current(),
+                       motor.position(vex::rotationUnits::rev),
+                       motor.temperature(vex::temperatureUnits::celsius)};
+}
+
+/**
+ * @brief Samples the drive motors, the InertialGyro and a controller once.
+ *
+ * @param controller The controller whose axes and buttons are captured.
+ */
+SensorFrame readSensorFrame(const vex::controller &controller)
+{
+    SensorFrame frame;
+    frame.timestampMs = vex::timer::system();
+    for (std::size_t i = 0; i < WheelCount; ++i)
+    {
+        frame.wheels[i] = readMotor(Devices.motor(DeviceRegistry::driveMotors[i]));
+    }
+    vex::inertial &inertialGyro = Devices.inertial();
+    frame.yawRateDps = inertialGyro.gyroRate(vex::axisType::zaxis, vex::velocityUnits::dps);
+    frame.rotationDeg = inertialGyro.rotation(vex::rotationUnits::deg);
+    frame.forwardAccelG = inertialGyro.acceleration(imuForwardAxis);
+    frame.collision = takeCollision();
+    if (vex::distance *distanceSensor = getFrontDistanceSensor(); distanceSensor && distanceSensor->isObjectDetected())
+    {
+        frame.obstacleDistanceM = distanceSensor->objectDistance(vex::distanceUnits::mm) / 1000.0;
+    }
+    frame.rearBumperPressed = Devices.rearBumper().pressing();
+    frame.sticks = readSticks(controller);
+    frame.buttons = readButtons(controller);
+    return frame;
+}
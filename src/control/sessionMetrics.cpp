@@ -0,0 +1,211 @@
+#include "vex.h"
+#include <fstream>
+
+SessionMetrics Metrics;
+
+std::uint64_t SessionMetrics::systemNow()
+{
+    return vex::timer::systemHighResolution();
+}
+
+SessionMetrics::SessionMetrics(std::uint64_t (*now)())
+    : now(now)
+{
+    mark(Milestone::StaticInit);
+}
+
+/**
+ * @brief Upper bound of the bucket holding the given fraction of the samples, capped at the maximum.
+ */
+std::uint64_t SessionMetrics::LatencyStats::percentileUs(double fraction) const
+{
+    const double target = fraction * samples;
+    std::uint32_t seen = 0;
+    for (std::size_t i = 0; i < buckets.size(); ++i)
+    {
+        seen += buckets[i];
+        if (seen > 0 && seen >= target)
+        {
+            return std::min<std::uint64_t>(std::uint64_t{1} << i, maxUs);
+        }
+    }
+    return maxUs;
+}
+
+/**
+ * @brief Stamps `milestone` with the current time. Only the first call for a milestone counts.
+ */
+void SessionMetrics::mark(Milestone milestone)
+{
+    std::uint64_t expected = 0;
+    const std::uint64_t stamp = std::max<std::uint64_t>(now(), 1); // 0 means not reached
+    milestones[static_cast<std::size_t>(milestone)].compare_exchange_strong(expected, stamp, std::memory_order_acq_rel);
+}
+
+bool SessionMetrics::sticksChanged(const StickSample &previous, const StickSample &current)
+{
+    for (std::size_t i = 0; i < current.axes.size(); ++i)
+    {
+        if (std::abs(current.axes[i] - previous.axes[i]) >= inputThreshold)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Stamps a stick change seen by the button service, the earliest the brain sees one.
+ *        Button service thread only.
+ */
+void SessionMetrics::noteControllerSticks(const StickSample &sticks)
+{
+    if (serviceHasSticks && sticksChanged(serviceSticks, sticks))
+    {
+        // Keep the first change the drive has not read yet.
+        std::uint64_t expected = 0;
+        controllerChangeUs.compare_exchange_strong(expected, std::max<std::uint64_t>(now(), 1), std::memory_order_acq_rel);
+    }
+    serviceSticks = sticks;
+    serviceHasSticks = true;
+}
+
+/**
+ * @brief Looks at the sticks read this tick; a change becomes a probe candidate. Drive thread only.
+ *
+ * @param tickSeconds The drive period, to count the ticks that were skipped since the last call.
+ */
+void SessionMetrics::noteInput(const StickSample &sticks, double tickSeconds)
+{
+    const std::uint64_t nowUs = now();
+    bool statsChanged = false;
+
+    const std::uint64_t periodUs = static_cast<std::uint64_t>(tickSeconds * 1e6);
+    if (lastInputUs != 0 && periodUs != 0 && nowUs - lastInputUs >= periodUs + periodUs / 2)
+    {
+        stats.missedTicks += static_cast<std::uint32_t>((nowUs - lastInputUs + periodUs / 2) / periodUs - 1);
+        statsChanged = true;
+    }
+    lastInputUs = nowUs;
+
+    const bool changed = hasSticks && sticksChanged(lastSticks, sticks);
+    lastSticks = sticks;
+    hasSticks = true;
+    const std::uint64_t seenUs = controllerChangeUs.exchange(0, std::memory_order_acq_rel);
+
+    if (probeStartUs != 0 && nowUs - probeStartUs > probeTimeoutUs)
+    {
+        ++stats.unanswered;
+        probeStartUs = 0;
+        statsChanged = true;
+    }
+    pendingStartUs = 0;
+    if (changed && probeStartUs == 0)
+    {
+        // From when the button service saw the change, if it saw it first.
+        const bool serviceFirst = seenUs != 0 && seenUs <= nowUs && nowUs - seenUs < probeTimeoutUs;
+        pendingStartUs = std::max<std::uint64_t>(serviceFirst ? seenUs : nowUs, 1);
+    }
+    if (statsChanged)
+    {
+        latency.write(stats);
+    }
+}
+
+/**
+ * @brief Opens the probe if this tick's stick change moved the command, and closes the open
+ *        probe on the first motor write. Drive thread only.
+ *
+ * @param command The input pipeline's command this tick.
+ * @param totalWrites The drive's motor write counter; a change since the last call is a write.
+ */
+void SessionMetrics::noteOutput(const DriveCommand &command, std::uint32_t totalWrites)
+{
+    const bool wrote = totalWrites != lastWrites;
+    lastWrites = totalWrites;
+    const bool commandMoved = hasCommand && (command.forwardVolts != lastCommand.forwardVolts || command.turnVolts != lastCommand.turnVolts);
+    lastCommand = command;
+    hasCommand = true;
+
+    // A change the pipeline absorbed, e.g. inside the deadzone, causes no write to wait for.
+    if (pendingStartUs != 0 && commandMoved)
+    {
+        probeStartUs = pendingStartUs;
+    }
+    pendingStartUs = 0;
+    if (probeStartUs == 0 || !wrote)
+    {
+        return;
+    }
+
+    const std::uint64_t sampleUs = now() - probeStartUs;
+    probeStartUs = 0;
+    stats.minUs = stats.samples == 0 ? sampleUs : std::min(stats.minUs, sampleUs);
+    stats.maxUs = std::max(stats.maxUs, sampleUs);
+    stats.totalUs += sampleUs;
+    ++stats.samples;
+    std::size_t bucket = 0;
+    while (bucket + 1 < stats.buckets.size() && (std::uint64_t{1} << bucket) <= sampleUs)
+    {
+        ++bucket;
+    }
+    ++stats.buckets[bucket];
+    latency.write(stats);
+}
+
+/**
+ * @brief The session in three short lines, sized for the brain screen.
+ */
+std::vector<std::string> SessionMetrics::reportLines() const
+{
+    auto ms = [this](Milestone milestone)
+    {
+        const std::uint64_t us = getMilestoneUs(milestone);
+        return us == 0 ? std::string("-") : std::to_string(us / 1000);
+    };
+    auto fractionMs = [](std::uint64_t us)
+    { return std::format("{:.1f}", us / 1000.0); };
+
+    const LatencyStats stats = getLatency();
+    std::string latencyLine = std::format("Stick->motor: n={} mean {} p95 {} max {} ms", stats.samples, fractionMs(stats.meanUs()), fractionMs(stats.percentileUs(0.95)), fractionMs(stats.maxUs));
+    if (stats.unanswered != 0)
+    {
+        latencyLine += std::format(" ({} no write)", stats.unanswered);
+    }
+    if (stats.missedTicks != 0)
+    {
+        latencyLine += std::format(" ({} missed ticks)", stats.missedTicks);
+    }
+    return {
+        std::format("Boot ms: init {} cfg {}-{} gyro {}-{} ready {}", ms(Milestone::StaticInit), ms(Milestone::ConfigStart), ms(Milestone::ConfigEnd), ms(Milestone::GyroStart), ms(Milestone::GyroEnd), ms(Milestone::BootReady)),
+        std::format("Controller {} ms, drivable {} ms", ms(Milestone::FirstController), ms(Milestone::FirstDriveTick)),
+        latencyLine};
+}
+
+/**
+ * @brief Writes reportLines() to `fileName`, replacing the previous session's report.
+ */
+bool SessionMetrics::save(const std::string &fileName) const
+{
+    std::ofstream file(fileName, std::ios::trunc);
+    for (const std::string &line : reportLines())
+    {
+        file << line << "\n";
+    }
+    return static_cast<bool>(file);
+}
+
+/**
+ * @brief Reads a report written by save(), e.g. the previous session's. Empty if there is none.
+ */
+std::vector<std::string> SessionMetrics::loadReport(const std::string &fileName)
+{
+    std::vector<std::string> lines;
+    std::ifstream file(fileName);
+    std::string line;
+    while (std::getline(file, line))
+    {
+        lines.push_back(line);
+    }
+    return lines;
+}
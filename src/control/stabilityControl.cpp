@@ -0,0 +1,55 @@
+#include "vex.h"
+
+void StabilityControl::reset()
+{
+    integral = 0;
+    holdingHeading = false;
+    heldHeading = 0;
+}
+
+/**
+ * @brief Returns the turn voltage with the yaw-rate correction applied.
+ *
+ * @param inputs The driver's forward and turn voltages and the current IMU readings.
+ * @return The corrected turn voltage, limited to +/- maxVolts.
+ */
+double StabilityControl::correctTurn(const Inputs &inputs)
+{
+    const bool driving = std::abs(inputs.forwardVolts) >= settings.holdMinForwardVolts;
+
+    if (inputs.turnVolts == 0 && inputs.forwardVolts == 0)
+    {
+        // Sticks released: the driver is stopping, do not fight it.
+        reset();
+        return 0;
+    }
+
+    double targetRate = inputs.turnVolts / settings.maxVolts * settings.maxTurnRateDps;
+
+    if (inputs.turnVolts == 0 && driving)
+    {
+        if (!holdingHeading)
+        {
+            holdingHeading = true;
+            heldHeading = inputs.rotationDeg;
+        }
+        targetRate = settings.headingKp * (heldHeading - inputs.rotationDeg);
+    }
+    else
+    {
+        holdingHeading = false;
+    }
+
+    double error = targetRate - inputs.yawRateDps;
+    double proportional = settings.rateKp * error;
+
+    // Only integrate while the correction is not saturated, so the integrator cannot wind up.
+    double candidate = integral + settings.rateKi * error * inputs.dtSeconds;
+    if (std::abs(proportional + candidate) <= settings.maxCorrectionVolts)
+    {
+        integral = candidate;
+    }
+
+    double correction = std::clamp(proportional + integral, -settings.maxCorrectionVolts, settings.maxCorrectionVolts);
+    return std::clamp(inputs.turnVolts + correction, -settings.maxVolts, settings.maxVolts);
+}
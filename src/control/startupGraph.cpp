@@ -0,0 +1,158 @@
+#include "vex.h"
+
+StartupGraph::StartupGraph(const PeriodicScheduler::Clock &clock)
+    : clock(clock)
+{
+}
+
+/**
+ * @brief Adds a boot step.
+ *
+ * @param name Name used in the boot timeline.
+ * @param function Work to run once.
+ * @param dependencies Ids of steps that must finish first. Ids of steps not added yet are ignored.
+ * @return The step id, used as a dependency of later steps and with getTiming().
+ */
+std::size_t StartupGraph::addStep(const std::string &name, StepFunction function, std::initializer_list<std::size_t> dependencies)
+{
+    Step step;
+    step.name = name;
+    step.function = std::move(function);
+    for (std::size_t dependency : dependencies)
+    {
+        if (dependency < steps.size())
+        {
+            step.dependencies.push_back(dependency);
+        }
+    }
+    steps.push_back(std::move(step));
+    return steps.size() - 1;
+}
+
+bool StartupGraph::isRunnable(const Step &step) const
+{
+    if (step.state != State::Waiting)
+    {
+        return false;
+    }
+    for (std::size_t dependency : step.dependencies)
+    {
+        if (steps[dependency].state != State::Done)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Marks the first runnable step as running and returns it, or nullptr. Call with stepsMutex held.
+StartupGraph::Step *StartupGraph::takeRunnable()
+{
+    for (Step &step : steps)
+    {
+        if (isRunnable(step))
+        {
+            step.state = State::Running;
+            step.timing.startUs = clock.now() - startUs;
+            return &step;
+        }
+    }
+    return nullptr;
+}
+
+// Starts a worker for every runnable step the running workers will not pick up, up to the
+// worker limit. The calling worker takes one step itself. Call with stepsMutex held.
+void StartupGraph::startWorkers()
+{
+    std::size_t runnable = 0;
+    for (const Step &step : steps)
+    {
+        runnable += isRunnable(step) ? 1 : 0;
+    }
+    for (std::size_t i = 1; i < runnable && activeWorkers < workerLimit; ++i)
+    {
+        ++activeWorkers;
+        workers.emplace_back(workerTask, this);
+    }
+}
+
+void StartupGraph::workLoop()
+{
+    stepsMutex.lock();
+    startWorkers();
+    while (Step *next = takeRunnable())
+    {
+        stepsMutex.unlock();
+
+        next->function();
+
+        stepsMutex.lock();
+        next->timing.endUs = clock.now() - startUs;
+        next->state = State::Done;
+        startWorkers();
+    }
+    --activeWorkers;
+    stepsMutex.unlock();
+}
+
+int StartupGraph::workerTask(void *arg)
+{
+    static_cast<StartupGraph *>(arg)->workLoop();
+    return 0;
+}
+
+/**
+ * @brief Runs every step and returns when all are done. The calling thread is one of the workers.
+ *
+ * @param workerCount Number of steps that may run at the same time, including the caller.
+ */
+void StartupGraph::run(std::size_t workerCount)
+{
+    startUs = clock.now();
+    workerLimit = std::max<std::size_t>(workerCount, 1);
+    activeWorkers = 1;
+    workLoop();
+
+    // Only a running worker starts another, so once every worker in the list has been joined
+    // no step is left. The list may still grow while earlier workers are joined.
+    auto joined = workers.end(); // The last worker joined; end() before the first
+    while (true)
+    {
+        stepsMutex.lock();
+        const auto worker = joined == workers.end() ? workers.begin() : std::next(joined);
+        const bool allJoined = worker == workers.end();
+        stepsMutex.unlock();
+        if (allJoined)
+        {
+            break;
+        }
+        worker->join();
+        joined = worker;
+    }
+    totalUs = clock.now() - startUs;
+
+    for (Step &step : steps)
+    {
+        step.timing.readyUs = 0;
+        for (std::size_t dependency : step.dependencies)
+        {
+            step.timing.readyUs = std::max(step.timing.readyUs, steps[dependency].timing.endUs);
+        }
+    }
+}
+
+/**
+ * @brief Logs when each step became runnable, started and finished, then the time to ready
+ *        next to what the same steps would have taken one after another.
+ */
+void StartupGraph::logTimeline() const
+{
+    std::uint64_t serialUs = 0;
+    for (const Step &step : steps)
+    {
+        const StepTiming &timing = step.timing;
+        serialUs += timing.runtimeUs();
+        logHandler("boot", std::format("{}: ready {} ms, ran {}-{} ms ({} ms)", step.name, timing.readyUs / 1000, timing.startUs / 1000, timing.endUs / 1000, timing.runtimeUs() / 1000), Log::Level::Debug);
+    }
+    logHandler("boot", std::format("Ready in {} ms ({} ms of steps).", totalUs / 1000, serialUs / 1000), Log::Level::Info);
+}
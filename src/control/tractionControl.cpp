@@ -0,0 +1,88 @@
+#include "vex.h"
+
+constexpr double gravity = 9.80665;
+
+/**
+ * @brief Updates the estimate from one tick of sensor readings.
+ *
+ * @param wheelRpm Measured wheel velocities, Wheel order.
+ * @param forwardAccelG IMU acceleration along the drive direction.
+ * @param yawRateDps IMU yaw rate, positive turning right.
+ * @param dtSeconds Time since the previous update.
+ */
+void ChassisSpeedEstimator::update(const std::array<double, WheelCount> &wheelRpm, double forwardAccelG, double yawRateDps, double dtSeconds)
+{
+    const double halfTrack = settings.trackWidthMeters / 2;
+    const double yawRate = yawRateDps * M_PI / 180.0;
+
+    // Wheel speeds projected to the chassis centre line by removing each side's turning component.
+    std::array<double, WheelCount> centredSpeeds;
+    for (std::size_t i = 0; i < WheelCount; ++i)
+    {
+        turnOffsets[i] = isLeftWheel(i) ? yawRate * halfTrack : -yawRate * halfTrack;
+        wheelSpeeds[i] = wheelRpm[i] / 60.0 * settings.wheelTravelMeters;
+        centredSpeeds[i] = wheelSpeeds[i] - turnOffsets[i];
+    }
+
+    double predicted = speed + forwardAccelG * gravity * dtSeconds;
+
+    double reference = centredSpeeds[0];
+    for (double centred : centredSpeeds)
+    {
+        if (std::abs(centred - predicted) < std::abs(reference - predicted))
+        {
+            reference = centred;
+        }
+    }
+
+    const bool allSlipping = std::abs(reference - predicted) > settings.wheelToleranceMs && std::abs(forwardAccelG) > settings.slippingAccelG;
+    const double imuWeight = allSlipping ? settings.slippingImuWeight : settings.imuWeight;
+    speed = imuWeight * predicted + (1.0 - imuWeight) * reference;
+}
+
+void TractionControl::reset()
+{
+    estimator.reset();
+    slip.fill(0);
+    scale.fill(1);
+}
+
+/**
+ * @brief Reduces the command of each wheel that is slipping.
+ *
+ * @param command The per-wheel voltages to limit, modified in place.
+ * @param inputs Wheel velocities, IMU readings and tick length.
+ */
+void TractionControl::apply(WheelVolts &command, const Inputs &inputs)
+{
+    estimator.update(inputs.wheelRpm, inputs.forwardAccelG, inputs.yawRateDps, inputs.dtSeconds);
+
+    for (std::size_t i = 0; i < WheelCount; ++i)
+    {
+        double wheelSpeed = estimator.getWheelSpeed(i);
+        double expected = estimator.getExpectedSpeed(i);
+        double magnitude = std::max(std::abs(wheelSpeed), std::abs(expected));
+        double direction = command.volts[i] > 0 ? 1.0 : (command.volts[i] < 0 ? -1.0 : 0.0);
+        bool braking = direction * expected < 0;
+
+        slip[i] = magnitude < settings.minSpeed || braking ? 0 : direction * (wheelSpeed - expected) / magnitude;
+
+        double targetScale = 1.0;
+        if (slip[i] > settings.targetSlip)
+        {
+            targetScale = std::max(settings.minScale, 1.0 - settings.slipGain * (slip[i] - settings.targetSlip));
+        }
+
+        // Cut immediately, recover gradually so the wheel does not break loose again.
+        if (targetScale < scale[i])
+        {
+            scale[i] = targetScale;
+        }
+        else
+        {
+            scale[i] = std::min(targetScale, scale[i] + settings.recoveryPerSecond * inputs.dtSeconds);
+        }
+
+        command.volts[i] *= scale[i];
+    }
+}
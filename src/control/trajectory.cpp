@@ -0,0 +1,230 @@
+#include "vex.h"
+#include <fstream>
+
+constexpr std::uint32_t trajectoryMagic = 0x4A415254; // "TRAJ"
+constexpr std::uint32_t trajectoryFormatVersion = 1;
+
+/**
+ * @struct TrajectoryFileHeader
+ * @brief Header written before the samples of a cached trajectory table.
+ */
+struct TrajectoryFileHeader
+{
+    std::uint32_t magic;
+    std::uint32_t formatVersion;
+    std::uint32_t inputHash;
+    std::uint32_t sampleCount;
+};
+
+/**
+ * @brief 32-bit FNV-1a over a block of bytes, continuing from `hash`.
+ */
+static std::uint32_t fnv1a(const void *data, std::size_t length, std::uint32_t hash = 2166136261u)
+{
+    const auto *bytes = static_cast<const std::uint8_t *>(data);
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * @brief Hashes everything that determines a generated trajectory.
+ *
+ * A cached table is only reused when this matches, so editing a waypoint or a limit
+ * invalidates the cache.
+ */
+std::uint32_t Trajectory::hashInputs(const std::vector<Waypoint> &waypoints, const TrajectoryConstraints &constraints)
+{
+    std::uint32_t hash = fnv1a(&trajectoryFormatVersion, sizeof(trajectoryFormatVersion));
+    hash = fnv1a(waypoints.data(), waypoints.size() * sizeof(Waypoint), hash);
+    return fnv1a(&constraints, sizeof(constraints), hash);
+}
+
+/**
+ * @brief Evaluates a uniform Catmull-Rom segment between p1 and p2.
+ */
+static Waypoint catmullRom(const Waypoint &p0, const Waypoint &p1, const Waypoint &p2, const Waypoint &p3, double t)
+{
+    double t2 = t * t;
+    double t3 = t2 * t;
+    auto blend = [&](double a, double b, double c, double d)
+    {
+        return 0.5 * ((2 * b) + (-a + c) * t + (2 * a - 5 * b + 4 * c - d) * t2 + (-a + 3 * b - 3 * c + d) * t3);
+    };
+    return Waypoint{blend(p0.x, p1.x, p2.x, p3.x), blend(p0.y, p1.y, p2.y, p3.y)};
+}
+
+/**
+ * @brief Generates a trajectory table from waypoints.
+ *
+ * @param waypoints At least two points, in metres.
+ * @param constraints Velocity, acceleration and spacing limits.
+ * @return The generated trajectory, or an empty one if there are too few waypoints.
+ */
+Trajectory Trajectory::generate(const std::vector<Waypoint> &waypoints, const TrajectoryConstraints &constraints)
+{
+    Trajectory trajectory;
+    trajectory.hash = hashInputs(waypoints, constraints);
+    if (waypoints.size() < 2)
+    {
+        logHandler("Trajectory::generate", "A trajectory needs at least two waypoints.", Log::Level::Error, 3);
+        return trajectory;
+    }
+
+    // Sample the spline. End points are duplicated so the curve passes through them.
+    std::vector<Waypoint> points;
+    for (std::size_t i = 0; i + 1 < waypoints.size(); ++i)
+    {
+        const Waypoint &p0 = waypoints[i == 0 ? 0 : i - 1];
+        const Waypoint &p1 = waypoints[i];
+        const Waypoint &p2 = waypoints[i + 1];
+        const Waypoint &p3 = waypoints[std::min(i + 2, waypoints.size() - 1)];
+
+        double chord = std::hypot(p2.x - p1.x, p2.y - p1.y);
+        int steps = std::max(1, static_cast<int>(std::ceil(chord / constraints.sampleSpacing)));
+        for (int step = 0; step < steps; ++step)
+        {
+            points.push_back(catmullRom(p0, p1, p2, p3, static_cast<double>(step) / steps));
+        }
+    }
+    points.push_back(waypoints.back());
+
+    const std::size_t count = points.size();
+    std::vector<double> distance(count, 0);
+    std::vector<double> heading(count, 0);
+    std::vector<double> curvature(count, 0);
+    std::vector<double> velocity(count, constraints.maxVelocity);
+
+    for (std::size_t i = 1; i < count; ++i)
+    {
+        distance[i] = distance[i - 1] + std::hypot(points[i].x - points[i - 1].x, points[i].y - points[i - 1].y);
+        heading[i] = std::atan2(points[i].y - points[i - 1].y, points[i].x - points[i - 1].x);
+    }
+    heading[0] = count > 1 ? heading[1] : 0;
+
+    // Signed curvature from the circle through each sample and its neighbours.
+    for (std::size_t i = 1; i + 1 < count; ++i)
+    {
+        double ax = points[i].x - points[i - 1].x, ay = points[i].y - points[i - 1].y;
+        double bx = points[i + 1].x - points[i].x, by = points[i + 1].y - points[i].y;
+        double cx = points[i + 1].x - points[i - 1].x, cy = points[i + 1].y - points[i - 1].y;
+        double denominator = std::hypot(ax, ay) * std::hypot(bx, by) * std::hypot(cx, cy);
+        curvature[i] = denominator > 1e-12 ? 2 * (ax * by - ay * bx) / denominator : 0;
+
+        if (std::abs(curvature[i]) > 1e-9)
+        {
+            velocity[i] = std::min(velocity[i], std::sqrt(constraints.maxLateralAcceleration / std::abs(curvature[i])));
+        }
+    }
+
+    // Trapezoidal profile: start and end at rest, respect the acceleration limit both ways.
+    velocity.front() = 0;
+    velocity.back() = 0;
+    for (std::size_t i = 1; i < count; ++i)
+    {
+        double ds = distance[i] - distance[i - 1];
+        velocity[i] = std::min(velocity[i], std::sqrt(velocity[i - 1] * velocity[i - 1] + 2 * constraints.maxAcceleration * ds));
+    }
+    for (std::size_t i = count - 1; i > 0; --i)
+    {
+        double ds = distance[i] - distance[i - 1];
+        velocity[i - 1] = std::min(velocity[i - 1], std::sqrt(velocity[i] * velocity[i] + 2 * constraints.maxAcceleration * ds));
+    }
+
+    trajectory.samples.reserve(count);
+    double time = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (i > 0)
+        {
+            double averageVelocity = (velocity[i] + velocity[i - 1]) / 2;
+            if (averageVelocity > 1e-9)
+            {
+                time += (distance[i] - distance[i - 1]) / averageVelocity;
+            }
+        }
+        trajectory.samples.push_back(TrajectorySample{static_cast<float>(points[i].x), static_cast<float>(points[i].y),
+                                                      static_cast<float>(heading[i]), static_cast<float>(curvature[i]),
+                                                      static_cast<float>(velocity[i]), static_cast<float>(time)});
+    }
+
+    return trajectory;
+}
+
+/**
+ * @brief Writes the sample table to a binary file.
+ *
+ * @return true if the whole table was written.
+ */
+bool Trajectory::save(const std::string &fileName) const
+{
+    std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        return false;
+    }
+    TrajectoryFileHeader header{trajectoryMagic, trajectoryFormatVersion, hash, static_cast<std::uint32_t>(samples.size())};
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char *>(samples.data()), samples.size() * sizeof(TrajectorySample));
+    return static_cast<bool>(file);
+}
+
+/**
+ * @brief Loads a cached sample table if it was generated from the same inputs.
+ *
+ * @param fileName The cache file.
+ * @param expectedHash Result of hashInputs() for the waypoints and constraints in use.
+ * @return true if the table was loaded; false if it is missing, stale or truncated.
+ */
+bool Trajectory::load(const std::string &fileName, std::uint32_t expectedHash)
+{
+    std::ifstream file(fileName, std::ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+
+    TrajectoryFileHeader header{};
+    if (!file.read(reinterpret_cast<char *>(&header), sizeof(header)) ||
+        header.magic != trajectoryMagic || header.formatVersion != trajectoryFormatVersion || header.inputHash != expectedHash)
+    {
+        return false;
+    }
+
+    std::vector<TrajectorySample> loaded(header.sampleCount);
+    if (!file.read(reinterpret_cast<char *>(loaded.data()), loaded.size() * sizeof(TrajectorySample)))
+    {
+        return false;
+    }
+
+    samples = std::move(loaded);
+    hash = header.inputHash;
+    return true;
+}
+
+/**
+ * @brief Returns a trajectory from the SD card cache, generating and caching it on a miss.
+ *
+ * Call this before the match (e.g. from pre-auton), never from autonomous().
+ */
+Trajectory loadOrGenerateTrajectory(const std::string &fileName, const std::vector<Waypoint> &waypoints, const TrajectoryConstraints &constraints)
+{
+    std::uint32_t hash = Trajectory::hashInputs(waypoints, constraints);
+    Trajectory trajectory;
+    if (Brain.SDcard.isInserted() && trajectory.load(fileName, hash))
+    {
+        logHandler("loadOrGenerateTrajectory", std::format("Loaded cached trajectory {} ({} samples).", fileName, trajectory.getSamples().size()), Log::Level::Debug);
+        return trajectory;
+    }
+
+    trajectory = Trajectory::generate(waypoints, constraints);
+    if (Brain.SDcard.isInserted() && !trajectory.save(fileName))
+    {
+        logHandler("loadOrGenerateTrajectory", std::format("Could not cache trajectory {}.", fileName), Log::Level::Warn, 2);
+    }
+    logHandler("loadOrGenerateTrajectory", std::format("Generated trajectory {} ({} samples, {:.2f}s).", fileName, trajectory.getSamples().size(), trajectory.getDuration()), Log::Level::Debug);
+    return trajectory;
+}
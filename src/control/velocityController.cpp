@@ -0,0 +1,54 @@
+#include "vex.h"
+
+void VelocityController::reset()
+{
+    integral = 0;
+    lastTarget = 0;
+    saturated = false;
+}
+
+/**
+ * @brief Computes the motor voltage for one control tick.
+ *
+ * @param targetRpm Desired side velocity.
+ * @param measuredRpm Measured side velocity.
+ * @param dtSeconds Time since the previous update, normally the fixed control period.
+ * @return Voltage command limited to +/- maxVolts.
+ */
+double VelocityController::update(double targetRpm, double measuredRpm, double dtSeconds)
+{
+    if (dtSeconds <= 0)
+    {
+        return 0;
+    }
+
+    double acceleration = (targetRpm - lastTarget) / dtSeconds;
+    lastTarget = targetRpm;
+
+    double feedforward = gains.kV * targetRpm + gains.kA * acceleration;
+    if (targetRpm > 0)
+    {
+        feedforward += gains.kS;
+    }
+    else if (targetRpm < 0)
+    {
+        feedforward -= gains.kS;
+    }
+
+    double error = targetRpm - measuredRpm;
+    double proportional = gains.kP * error;
+    double unsaturated = feedforward + proportional + integral;
+
+    // Conditional integration: stop integrating when the output is already pinned in the
+    // direction the error would push it.
+    bool pushingHigh = unsaturated >= maxVolts && error > 0;
+    bool pushingLow = unsaturated <= -maxVolts && error < 0;
+    if (!pushingHigh && !pushingLow)
+    {
+        integral = std::clamp(integral + gains.kI * error * dtSeconds, -maxVolts, maxVolts);
+    }
+
+    double output = feedforward + proportional + integral;
+    saturated = std::abs(output) > maxVolts;
+    return std::clamp(output, -maxVolts, maxVolts);
+}
@@ -0,0 +1,94 @@
+#include "vex.h"
+#include <atomic>
+#include <cstring>
+
+/**
+ * @struct DeferredMessage
+ * @brief A log message waiting for the log thread, copied into fixed buffers so queueing never allocates.
+ */
+struct DeferredMessage
+{
+    Log::Level level = Log::Level::Debug;
+    float timeOfDisplay = 0;
+    std::array<char, 32> functionName{};
+    std::array<char, 160> message{};
+};
+
+// Messages from control loops. Producers take the mutex only to copy into the queue; the log
+// thread is the only consumer.
+static EventQueue<DeferredMessage, 32> deferredMessages;
+static vex::mutex deferredProducerMutex;
+static std::atomic<bool> deferredLogStarted{false};
+
+template <std::size_t Size>
+static void copyTruncated(std::array<char, Size> &destination, const std::string &text)
+{
+    const std::size_t length = std::min(text.size(), destination.size() - 1);
+    std::memcpy(destination.data(), text.data(), length);
+    destination[length] = '\0';
+}
+
+/**
+ * @brief Queues a message for logHandler() on the log thread and returns at once.
+ *
+ * For control loops and other timed threads: logHandler() appends to the SD card and, from
+ * Warn up, shows the message on the controllers for `timeOfDisplay` seconds before it returns.
+ * Here that time is spent on the log thread instead. Messages longer than the queue slot are
+ * cut short, and a message that finds the queue full is dropped.
+ *
+ * @return false if the message was dropped.
+ */
+bool logDeferred(const std::string &functionName, const std::string &message, const Log::Level level, const float &timeOfDisplay)
+{
+    DeferredMessage deferred;
+    deferred.level = level;
+    deferred.timeOfDisplay = timeOfDisplay;
+    copyTruncated(deferred.functionName, functionName);
+    copyTruncated(deferred.message, message);
+
+    deferredProducerMutex.lock();
+    const bool queued = deferredMessages.push(deferred);
+    deferredProducerMutex.unlock();
+    return queued;
+}
+
+/**
+ * @brief Hands every queued message to logHandler() on the calling thread. Log thread only.
+ */
+void flushDeferredLogs()
+{
+    static std::uint32_t droppedReported = 0;
+    DeferredMessage deferred;
+    while (deferredMessages.pop(deferred))
+    {
+        logHandler(deferred.functionName.data(), deferred.message.data(), deferred.level, deferred.timeOfDisplay);
+    }
+    if (const std::uint32_t dropped = deferredMessages.getDropped(); dropped != droppedReported)
+    {
+        logHandler("logDeferred", std::format("{} messages dropped, the log thread fell behind.", dropped - droppedReported), Log::Level::Debug);
+        droppedReported = dropped;
+    }
+}
+
+static int deferredLogTask()
+{
+    while (true)
+    {
+        flushDeferredLogs();
+        vex::this_thread::sleep_for(20);
+    }
+    return 0;
+}
+
+/**
+ * @brief Starts the log thread that writes out logDeferred() messages. Calling it again does nothing.
+ */
+void startDeferredLogging()
+{
+    if (deferredLogStarted.exchange(true))
+    {
+        return;
+    }
+    vex::thread logThread(deferredLogTask);
+    logThread.detach();
+}
@@ -43,11 +43,11 @@ void displayMotorData(vex::motor &m)
         // no motor
         Brain.Screen.setFillColor(grey);
     }
-    else if (m.index() == frontLeftMotor.index() || m.index() == rearLeftMotor.index())
+    else if (m.index() == Devices.motor(configManager::Device::FrontLeftMotor).index() || m.index() == Devices.motor(configManager::Device::RearLeftMotor).index())
     {
         Brain.Screen.setFillColor(lblue);
     }
-    else if (m.index() == frontRightMotor.index() || m.index() == rearRightMotor.index())
+    else if (m.index() == Devices.motor(configManager::Device::FrontRightMotor).index() || m.index() == Devices.motor(configManager::Device::RearRightMotor).index())
     {
         Brain.Screen.setFillColor(lred);
     }
@@ -98,22 +98,31 @@ void displayTask()
     Brain.Screen.setPenColor(vex::red);
     Brain.Screen.printAt(90, 160, "DIAGNOSTIC MODE");
 
-    vex::motor *motors[] = {&frontLeftMotor,
-                            &frontRightMotor,
-                            &rearLeftMotor,
-                            &rearRightMotor};
+    constexpr configManager::Device motors[] = {configManager::Device::FrontLeftMotor,
+                                                configManager::Device::FrontRightMotor,
+                                                configManager::Device::RearLeftMotor,
+                                                configManager::Device::RearRightMotor};
+
+    // This boot's milestones, then the latency measured while driving last session
+    const std::vector<std::string> lastSession = SessionMetrics::loadReport(SessionMetrics::reportFileName);
 
     while (true)
     {
-        for (auto &motor : motors)
+        for (auto motor : motors)
         {
-            displayMotorData(*motor);
+            displayMotorData(Devices.motor(motor));
         }
 
         // Display battery status
         Brain.Screen.setCursor(10, 1);
         Brain.Screen.print("Battery: {}%", Brain.Battery.capacity());
 
+        Brain.Screen.setFont(vex::mono12);
+        const std::vector<std::string> thisSession = Metrics.reportLines();
+        Brain.Screen.printAt(5, 95, true, "%s", thisSession[0].c_str());
+        Brain.Screen.printAt(5, 110, true, "%s", thisSession[1].c_str());
+        Brain.Screen.printAt(5, 125, true, "Last: %s", lastSession.size() > 2 ? lastSession[2].c_str() : "no session recorded");
+
         // Display using back buffer, stops flickering
         Brain.Screen.render();
 
@@ -159,115 +168,64 @@ std::string getUserOption(const std::string &settingName, const std::vector<std:
 
     std::size_t wrongAttemptCount = 0;
     std::size_t Index = options.size(); // Invalid selection by default
-    int offset = 0;
-    std::string buttonString;
-
-    const auto buttonsInfo = getControllerButtonArray(primaryController);
-    std::vector<std::string> buttons;
-    std::vector<std::string> scrollButtons;
-
-    for (const auto &buttonInfo : buttonsInfo)
-    {
-        if (buttonInfo.name == "A" || buttonInfo.name == "X" || buttonInfo.name == "Y" || buttonInfo.name == "B")
-        {
-            buttons.push_back(buttonInfo.name);
-        }
-        else if (buttonInfo.name == "DOWN" || buttonInfo.name == "UP")
-        {
-            scrollButtons.push_back(buttonInfo.name);
-        }
-    }
 
     while (!primaryController.installed())
     {
         vex::this_thread::sleep_for(25);
     }
 
+    OptionMenu menu;
+    menu.open(settingName, options);
+    Buttons.clear(); // Drop presses made before the menu was shown
+
+    partnerController.Screen.clearScreen();
+    partnerController.Screen.setCursor(1, 1);
+    partnerController.Screen.print("Waiting for #1...");
+
+    vex::timer idleTimer;
     while (!Competition.isEnabled() && primaryController.installed())
     {
-        buttonString.clear(); // fix bug of buttons not displaying
-        primaryController.Screen.clearScreen();
-        primaryController.Screen.setCursor(1, 1);
-        partnerController.Screen.clearScreen();
-        partnerController.Screen.setCursor(1, 1);
-        primaryController.Screen.print(settingName.c_str());
-        partnerController.Screen.print("Waiting for #1...");
-
-        int displayedOptions = std::min(static_cast<int>(options.size() - offset), static_cast<int>(buttons.size()));
-        std::string displayBuffer;
-        displayBuffer.reserve(128); // Reserve some space to avoid multiple allocations (Fixes bug of random characters appearing on the screen)
-
-        for (int i = 0; i < displayedOptions; ++i) // Display available options
-        {
-            displayBuffer += std::format("{}: {}\n", buttons[i], options[i + offset]);
-            buttonString += buttons[i];
-            if (i != displayedOptions - 1) // Add comma if not the last button
-            {
-                buttonString += ", ";
-            }
-        }
+        menu.render(primaryController);
 
-        if (options.size() > buttons.size())
+        ButtonEvent event;
+        OptionMenu::Action action = OptionMenu::Action::None;
+        std::string buttonPressedStr = "none";
+        if (Buttons.waitFor(event, 100))
         {
-            if (offset + displayedOptions < static_cast<int>(options.size()))
-            {
-                displayBuffer += ">\n";
-            }
-            if (offset > 0)
-            {
-                displayBuffer += "^\n";
-            }
+            action = menu.handle(event);
+            buttonPressedStr = buttonName(event.button);
         }
-
-        primaryController.Screen.print(displayBuffer.c_str());
-
-        optmessage = std::format("Available buttons for current visible options: {}", buttonString); // Append button string to message.
-        logHandler("getUserOption", optmessage, Log::Level::Debug);
-
-        auto buttonPressed = controllerButtonsPressed(primaryController);
-        std::string buttonPressedStr;
-        if (!buttonPressed.empty())
+        else if (idleTimer.time() >= 30000)
         {
-            buttonPressedStr = buttonPressed.begin()->first;
+            action = OptionMenu::Action::Invalid; // No answer for 30 seconds counts as a wrong attempt
         }
 
-        auto buttonIt = std::ranges::find(buttons, buttonPressedStr);
-        if (buttonIt != buttons.end())
+        if (action == OptionMenu::Action::None)
         {
-            int buttonIndex = std::distance(buttons.begin(), buttonIt);
-            if (buttonIndex < displayedOptions)
-            {
-                Index = buttonIndex + offset;
-                logHandler("getUserOption", std::format("[Valid Selection] Index = {} | Offset = {} | Button Pressed = {}", Index, offset, buttonPressedStr), Log::Level::Debug);
-                break;
-            }
+            continue;
         }
-        else if (std::ranges::find(scrollButtons, buttonPressedStr) != scrollButtons.end())
+        idleTimer.clear();
+
+        if (action == OptionMenu::Action::Selected)
         {
-            if (buttonPressedStr == "DOWN" && (offset + displayedOptions < static_cast<int>(options.size())))
-            {
-                ++offset;
-            }
-            else if (buttonPressedStr == "UP" && offset > 0)
-            {
-                --offset;
-            }
-            logHandler("getUserOption", std::format("[Scroll {}] Offset = {}", buttonPressedStr, offset), Log::Level::Debug);
+            Index = menu.getSelection();
+            logHandler("getUserOption", std::format("[Valid Selection] Index = {} | Button Pressed = {}", Index, buttonPressedStr), Log::Level::Debug);
+            break;
         }
-        else
+        else if (action == OptionMenu::Action::Invalid)
         {
-            logHandler("getUserOption", std::format("[Invalid Selection] Index = {} | Offset = {} | Button Pressed = {}", Index, offset, buttonPressedStr), Log::Level::Debug);
+            logHandler("getUserOption", std::format("[Invalid Selection] Index = {} | Button Pressed = {}", Index, buttonPressedStr), Log::Level::Debug);
             // Display message
             if (wrongAttemptCount < maxWrongAttempts)
             {
                 primaryController.Screen.clearScreen();
                 primaryController.Screen.setCursor(1, 1);
-                partnerController.Screen.clearScreen();
-                partnerController.Screen.setCursor(1, 1);
                 primaryController.Screen.print(wrongMessages[wrongAttemptCount].c_str());
                 ++wrongAttemptCount; // Increment wrong attempt count
                 logHandler("getUserOption", std::format("wrongAttemptCount: {}", wrongAttemptCount), Log::Level::Debug);
                 vex::this_thread::sleep_for(2000);
+                Buttons.clear();
+                menu.open(settingName, options); // Redraw the first page
             }
             else
             {
@@ -12,89 +12,18 @@
  */
 void calibrateGyro()
 {
-    InertialGyro.calibrate();
-    while (InertialGyro.isCalibrating())
+    Metrics.mark(SessionMetrics::Milestone::GyroStart);
+    vex::inertial &inertialGyro = Devices.inertial();
+    inertialGyro.calibrate();
+    while (inertialGyro.isCalibrating())
     {
         vex::this_thread::sleep_for(20);
     }
+    Metrics.mark(SessionMetrics::Milestone::GyroEnd);
     logHandler("calibrateGyro", "Finished calibrating Inertial Gyro.", Log::Level::Trace);
     return;
 }
 
-/**
- * @brief Monitors and records the durations of button presses on a controller.
- *
- * This function checks the press state of each button on the provided controller and logs
- * the duration of each press. When a button is pressed, it records the start time; when released,
- * it logs the duration based on the elapsed time measured by an internal timer.
- *
- * During a competition (i.e., when Competition.isEnabled() returns true), it logs an error message.
- * Otherwise, it continues to poll the controller's buttons until either competition mode is enabled 
- * or a 30-second timeout is reached.
- *
- * Each button's press durations are stored in a map with the button name as the key and a vector of 
- * integers as the value. A placeholder value of -1 is used to mark the beginning of a press event.
- *
- * @param controller A constant reference to a vex::controller object, representing the controller to monitor.
- *
- * @return std::map<std::string, std::vector<int>> A map from button names to vectors of press durations in milliseconds.
- *
- * @note The polling rate for button state checks is determined by the value returned from 
- *       ConfigManager.getCtrlr1PollingRate(), and the function uses local timers to measure durations.
- */
-std::map<std::string, std::vector<int>> controllerButtonsPressed(const vex::controller &controller)
-{
-    if (Competition.isEnabled())
-    {
-        logHandler("controllerButtonsPressed", "Robot is IN competition mode!", Log::Level::Error, 3);
-    }
-
-    std::map<std::string, std::vector<int>> buttonPressTimes;
-    vex::timer pressTimer;
-
-    static std::array<ControllerButtonInfo, 12> AllControllerButtons = createControllerButtonArray(controller);
-
-    auto checkButtonPress = [&](const ControllerButtonInfo &info)
-    {
-        if (info.button->pressing())
-        {
-            if (buttonPressTimes[info.name].empty() || buttonPressTimes[info.name].back() != -1)
-            {
-                pressTimer.clear();
-                buttonPressTimes[info.name].push_back(-1); // Mark the start of a press
-            }
-        }
-        else
-        {
-            if (!buttonPressTimes[info.name].empty() && buttonPressTimes[info.name].back() == -1)
-            {
-                buttonPressTimes[info.name].back() = pressTimer.time(); // Record the press duration
-            }
-        }
-    };
-
-    vex::timer timeoutTimer;
-    while (!Competition.isEnabled() && timeoutTimer.time() < 30000) // 30 seconds timeout
-    {
-        for (const auto &buttonInfo : AllControllerButtons)
-        {
-            checkButtonPress(buttonInfo);
-        }
-        vex::this_thread::sleep_for(ConfigManager.getCtrlr1PollingRate());
-    }
-
-    for (const auto &[buttonName, pressDurations] : buttonPressTimes)
-    {
-        for (auto pressDuration : pressDurations)
-        {
-            std::string logMessage = std::format("Button: {}, Duration: {} ms", buttonName, pressDuration);
-            logHandler("controllerButtonsPressed", logMessage, Log::Level::Debug);
-        }
-    }
-
-    return buttonPressTimes;
-}
-
 std::string formatMotorTemps(const std::array<int, 4> &motorTemps, double batteryVoltage)
 {
     return std::format("\n | LeftTemp: {}°\n | RightTemp: {}°\n | RearLeftTemp: {}°\n | RearRightTemp: {}°\n | Battery Voltage: {}V\n",
@@ -136,10 +65,10 @@ void motorMonitor()
     while (Competition.isEnabled())
     {
         std::array motorTemps = {
-            static_cast<int>(frontLeftMotor.temperature(vex::temperatureUnits::celsius)),
-            static_cast<int>(frontRightMotor.temperature(vex::temperatureUnits::celsius)),
-            static_cast<int>(rearLeftMotor.temperature(vex::temperatureUnits::celsius)),
-            static_cast<int>(rearRightMotor.temperature(vex::temperatureUnits::celsius))};
+            static_cast<int>(Devices.motor(configManager::Device::FrontLeftMotor).temperature(vex::temperatureUnits::celsius)),
+            static_cast<int>(Devices.motor(configManager::Device::FrontRightMotor).temperature(vex::temperatureUnits::celsius)),
+            static_cast<int>(Devices.motor(configManager::Device::RearLeftMotor).temperature(vex::temperatureUnits::celsius)),
+            static_cast<int>(Devices.motor(configManager::Device::RearRightMotor).temperature(vex::temperatureUnits::celsius))};
 
         constexpr std::array motorNames = {"FLM", "FRM", "RLM", "RRM"};
 
@@ -158,8 +87,8 @@ void motorMonitor()
                 motorTempsStr = formatMotorTemps(motorTemps, Brain.Battery.voltage());
             }
 
-            int leftMotorPosition = LeftDriveSmart.position(vex::rotationUnits::deg);
-            int rightMotorPosition = RightDriveSmart.position(vex::rotationUnits::deg);
+            int leftMotorPosition = Devices.sidePositionDeg(DeviceRegistry::Side::Left);
+            int rightMotorPosition = Devices.sidePositionDeg(DeviceRegistry::Side::Right);
             int averagePosition = (leftMotorPosition + rightMotorPosition) / 2;
             ConfigManager.updateOdometer(averagePosition);
 
@@ -170,9 +99,9 @@ void motorMonitor()
             logHandler("motorMonitor", motorTempsStr, Log::Level::Info);
 
             std::string dataBuffer = std::format("\nX Axis: {}\nY Axis: {}\nZ Axis: {}",
-                                                 InertialGyro.pitch(vex::rotationUnits::deg),
-                                                 InertialGyro.roll(vex::rotationUnits::deg),
-                                                 InertialGyro.yaw(vex::rotationUnits::deg));
+                                                 Devices.inertial().pitch(vex::rotationUnits::deg),
+                                                 Devices.inertial().roll(vex::rotationUnits::deg),
+                                                 Devices.inertial().yaw(vex::rotationUnits::deg));
             logHandler("motorMonitor", dataBuffer, Log::Level::Info);
 
             primaryController.Screen.clearScreen();
@@ -0,0 +1,208 @@
+#include "vex.h"
+
+ButtonService Buttons;
+
+const char *buttonName(ControllerButton button)
+{
+    static constexpr const char *names[] = {"A", "B", "X", "Y", "Up", "Down", "Left", "Right", "L1", "L2", "R1", "R2"};
+    return names[static_cast<std::uint8_t>(button)];
+}
+
+/**
+ * @brief Compares a new button mask with the previous one and emits the resulting events.
+ *
+ * @param buttons Current button mask, see readButtons().
+ * @param nowMs Sample time.
+ * @param controllerIndex Stored in every emitted event.
+ * @param emit Called once per event, in button order.
+ */
+void ButtonEventDetector::update(std::uint16_t buttons, std::uint32_t nowMs, std::uint8_t controllerIndex, const std::function<void(const ButtonEvent &)> &emit)
+{
+    for (std::uint8_t i = 0; i < pressedAt.size(); ++i)
+    {
+        const std::uint16_t bit = static_cast<std::uint16_t>(1u << i);
+        const bool down = buttons & bit;
+        const bool wasDown = previous & bit;
+
+        ButtonEvent event;
+        event.controllerIndex = controllerIndex;
+        event.button = static_cast<ControllerButton>(i);
+        event.timestampMs = nowMs;
+
+        if (down && !wasDown)
+        {
+            pressedAt[i] = nowMs;
+            nextRepeatAt[i] = nowMs + settings.repeatDelayMs;
+            longPressSent &= static_cast<std::uint16_t>(~bit);
+            event.type = ButtonEvent::Type::Press;
+            emit(event);
+        }
+        else if (!down && wasDown)
+        {
+            event.type = ButtonEvent::Type::Release;
+            event.heldMs = nowMs - pressedAt[i];
+            emit(event);
+        }
+        else if (down)
+        {
+            event.heldMs = nowMs - pressedAt[i];
+            if (!(longPressSent & bit) && event.heldMs >= settings.longPressMs)
+            {
+                longPressSent |= bit;
+                event.type = ButtonEvent::Type::LongPress;
+                emit(event);
+            }
+            if (static_cast<std::int32_t>(nowMs - nextRepeatAt[i]) >= 0)
+            {
+                nextRepeatAt[i] = nowMs + settings.repeatIntervalMs;
+                event.type = ButtonEvent::Type::Repeat;
+                emit(event);
+            }
+        }
+    }
+    previous = buttons;
+}
+
+/**
+ * @brief Starts the sampling thread. Calling it again does nothing.
+ *
+ * @param pollMs Sampling period of both controllers.
+ */
+void ButtonService::start(std::uint32_t pollMs)
+{
+    if (running)
+    {
+        return;
+    }
+    this->pollMs = pollMs;
+    running = true;
+    vex::thread serviceThread(serviceTask, this);
+    serviceThread.detach();
+}
+
+/**
+ * @brief Registers a callback for every event.
+ *
+ * Must be called before start(). Callbacks run on the service thread and must not block.
+ */
+void ButtonService::subscribe(const Subscriber &subscriber)
+{
+    if (running)
+    {
+        logHandler("ButtonService::subscribe", "Subscribers must be added before the service starts.", Log::Level::Warn, 2);
+        return;
+    }
+    subscribers.push_back(subscriber);
+}
+
+/**
+ * @brief Claims the event queue for the calling thread until endConsuming().
+ *
+ * @return false if another thread is polling or waiting; the first overlap is logged.
+ */
+bool ButtonService::beginConsuming()
+{
+    if (!consuming.exchange(true, std::memory_order_acquire))
+    {
+        return true;
+    }
+    if (!overlapReported.exchange(true))
+    {
+        logDeferred("ButtonService", "Two threads are reading button events at once.", Log::Level::Error);
+    }
+    return false;
+}
+
+/**
+ * @brief Takes the next event if there is one.
+ *
+ * @return false if the queue is empty or another thread is reading it.
+ */
+bool ButtonService::poll(ButtonEvent &event)
+{
+    if (!beginConsuming())
+    {
+        return false;
+    }
+    const bool popped = events.pop(event);
+    endConsuming();
+    return popped;
+}
+
+/**
+ * @brief Waits for the next event.
+ *
+ * @param event Receives the event.
+ * @param timeoutMs Longest time to wait.
+ * @return false if no event arrived in time, or another thread is reading the queue.
+ */
+bool ButtonService::waitFor(ButtonEvent &event, std::uint32_t timeoutMs)
+{
+    if (!beginConsuming())
+    {
+        vex::this_thread::sleep_for(timeoutMs);
+        return false;
+    }
+    vex::timer waitTimer;
+    bool popped = true;
+    while (!events.pop(event))
+    {
+        if (waitTimer.time() >= timeoutMs)
+        {
+            popped = false;
+            break;
+        }
+        vex::this_thread::sleep_for(pollMs);
+    }
+    endConsuming();
+    return popped;
+}
+
+/**
+ * @brief Drops every queued event, e.g. presses made before a menu was shown.
+ */
+void ButtonService::clear()
+{
+    if (beginConsuming())
+    {
+        events.clear();
+        endConsuming();
+    }
+}
+
+int ButtonService::serviceTask(void *arg)
+{
+    ButtonService &service = *static_cast<ButtonService *>(arg);
+    const vex::controller *controllers[] = {&primaryController, &partnerController};
+
+    auto emit = [&service](const ButtonEvent &event)
+    {
+        service.events.push(event);
+        for (const auto &subscriber : service.subscribers)
+        {
+            subscriber(event);
+        }
+    };
+
+    bool controllerSeen = false;
+    PeriodicScheduler scheduler;
+    scheduler.addTask("buttonService", service.pollMs, 0, [&]()
+                      {
+                          if (!controllerSeen && primaryController.installed())
+                          {
+                              Metrics.mark(SessionMetrics::Milestone::FirstController);
+                              controllerSeen = true;
+                          }
+                          Metrics.noteControllerSticks(readSticks(primaryController)); // Latency probes start here
+                          const std::uint32_t nowMs = vex::timer::system();
+                          for (std::uint8_t i = 0; i < std::size(controllers); ++i)
+                          {
+                              std::uint16_t buttons = readButtons(*controllers[i]);
+                              service.state[i].store(buttons, std::memory_order_release);
+                              service.detectors[i].update(buttons, nowMs, i, emit);
+                          }
+                      });
+    scheduler.run([]()
+                  { return true; });
+    return 0;
+}
@@ -0,0 +1,172 @@
+#include "vex.h"
+
+/**
+ * @brief Opens the menu on its first page.
+ *
+ * @param title Shown above the options.
+ * @param options The choices, in button order.
+ * @param cancellable Whether Left closes the menu without a selection.
+ */
+void OptionMenu::open(const std::string &title, const std::vector<std::string> &options, bool cancellable)
+{
+    this->title = title;
+    this->options = options;
+    this->cancellable = cancellable;
+    state = options.empty() ? State::Cancelled : State::Open;
+    offset = 0;
+    selection = 0;
+    dirty = true;
+}
+
+/**
+ * @brief Advances the menu by one button event.
+ *
+ * Only presses (and auto-repeat for scrolling) on the primary controller count.
+ */
+OptionMenu::Action OptionMenu::handle(const ButtonEvent &event)
+{
+    if (state != State::Open || event.controllerIndex != 0)
+    {
+        return Action::None;
+    }
+    const bool repeat = event.type == ButtonEvent::Type::Repeat;
+    if (event.type != ButtonEvent::Type::Press && !repeat)
+    {
+        return Action::None;
+    }
+
+    if (event.button == ControllerButton::Down || event.button == ControllerButton::Up)
+    {
+        // Scrolling past either end changes nothing, so there is nothing to redraw.
+        if (event.button == ControllerButton::Down && offset + visibleCount() < options.size())
+        {
+            ++offset;
+            dirty = true;
+        }
+        else if (event.button == ControllerButton::Up && offset > 0)
+        {
+            --offset;
+            dirty = true;
+        }
+        return Action::Scrolled;
+    }
+    if (repeat)
+    {
+        return Action::None;
+    }
+
+    if (cancellable && event.button == ControllerButton::Left)
+    {
+        state = State::Cancelled;
+        return Action::Cancelled;
+    }
+
+    for (std::size_t i = 0; i < visibleCount(); ++i)
+    {
+        if (selectButtons[i] == event.button)
+        {
+            selection = offset + i;
+            state = State::Selected;
+            return Action::Selected;
+        }
+    }
+    return Action::Invalid;
+}
+
+/**
+ * @brief Draws the menu on a controller if it changed since the last call.
+ *
+ * @return true if anything was drawn.
+ */
+bool OptionMenu::render(vex::controller &controller)
+{
+    if (!dirty || state != State::Open)
+    {
+        return false;
+    }
+    dirty = false;
+
+    std::string displayBuffer;
+    displayBuffer.reserve(128); // Avoids reallocating while the lines are appended
+    for (std::size_t i = 0; i < visibleCount(); ++i)
+    {
+        displayBuffer += std::format("{}: {}\n", buttonName(selectButtons[i]), options[offset + i]);
+    }
+    if (offset + visibleCount() < options.size())
+    {
+        displayBuffer += ">\n";
+    }
+    if (offset > 0)
+    {
+        displayBuffer += "^\n";
+    }
+
+    controller.Screen.clearScreen();
+    controller.Screen.setCursor(1, 1);
+    controller.Screen.print(title.c_str());
+    controller.Screen.print(displayBuffer.c_str());
+    return true;
+}
+
+/**
+ * @brief Steps the drive mode menu with one button event. UI task only.
+ *
+ * A press of Up on the primary controller opens the menu. A selection is saved to the config
+ * here and handed to the drive tick through applyPendingMode().
+ */
+void DriveModeMenu::handle(const ButtonEvent &event)
+{
+    static const std::vector<std::string> driveModeOptions = {"Left Arcade", "Right Arcade", "Split Arcade", "Tank"};
+
+    if (!menu.isOpen())
+    {
+        if (event.controllerIndex == 0 && event.type == ButtonEvent::Type::Press && event.button == ControllerButton::Up)
+        {
+            menu.open("Drive Mode", driveModeOptions, true);
+            open.store(true, std::memory_order_release);
+        }
+        return;
+    }
+
+    const OptionMenu::Action action = menu.handle(event);
+    if (action != OptionMenu::Action::Selected && action != OptionMenu::Action::Cancelled)
+    {
+        return;
+    }
+    primaryController.Screen.clearScreen();
+    primaryController.Screen.setCursor(1, 1);
+    if (action == OptionMenu::Action::Selected)
+    {
+        // Options are listed in DriveMode order.
+        const auto mode = static_cast<configManager::DriveMode>(menu.getSelection());
+        ConfigManager.setDriveMode(mode);
+        pendingMode.store(static_cast<int>(mode), std::memory_order_release);
+        primaryController.Screen.print("Drive Mode Selected");
+    }
+    close();
+}
+
+/**
+ * @brief Closes the menu without a selection, e.g. when driver control ends.
+ */
+void DriveModeMenu::close()
+{
+    menu.close();
+    open.store(false, std::memory_order_release);
+}
+
+/**
+ * @brief Applies a mode chosen in the menu since the last call. Drive tick only.
+ *
+ * @return true if the drive was reconfigured.
+ */
+bool DriveModeMenu::applyPendingMode(DriveSystem &drive)
+{
+    const int next = pendingMode.exchange(-1, std::memory_order_acq_rel);
+    if (next < 0 || static_cast<configManager::DriveMode>(next) == drive.getDriveMode())
+    {
+        return false;
+    }
+    drive.configure(static_cast<configManager::DriveMode>(next));
+    return true;
+}
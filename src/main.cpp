@@ -15,7 +15,38 @@ std::string BuildDate = "2/22/25";
 int main()
 {
     printf("\033[2J\033[1;1H\033[0m"); // Clears console and Sets color to grey.
-    ConfigManager.parseConfig();
+    Buttons.start(); // Menus during config parsing and startup wait on button events
+    startDeferredLogging(); // Control loops log through this thread instead of waiting on the SD card
+
+    // Independent steps run side by side; the gyro's calibration wait hides the others.
+    StartupGraph boot;
+    const auto config = boot.addStep("config", []
+                                     { ConfigManager.parseConfig(); });
+    const auto devices = boot.addStep("devices", []
+                                      { Devices.begin(); }, {config});
+    const auto gyro = boot.addStep("gyro", calibrateGyro, {devices});
+    boot.addStep("logo", []
+                 { gifplayer(ConfigManager.getVsyncGif()); }, {config});
+    boot.addStep("services", []
+                 {
+                     ConfigManager.startWatching();           // Live settings such as deadzones reload without a restart
+                     ConfigManager.startMaintenanceJournal(); // Odometer progress survives power-off
+                 },
+                 {config});
+    boot.addStep("autonRoute", prepareAutonomous, {config}); // Its logging reads the config
+    // The motor pulses move the robot slightly, so odometry starts after them.
+    const auto preflight = boot.addStep("preflight", []
+                                        { runPreflight(); }, {gyro});
+    boot.addStep("odometry", []
+                 {
+                     vex::thread odometryThread(odometryTask);
+                     odometryThread.detach();
+                 },
+                 {preflight});
+    boot.run();
+    Metrics.mark(SessionMetrics::Milestone::BootReady);
+    boot.logTimeline();
+
     Competition.autonomous(autonomous);
     Competition.drivercontrol(userControl);
     vexCodeInit();
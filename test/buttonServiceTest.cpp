@@ -0,0 +1,225 @@
+#include "vex.h"
+#include "testing.h"
+#include <atomic>
+#include <thread>
+
+using Type = ButtonEvent::Type;
+
+/// @brief Feeds a scripted controller through readButtons() and a detector, collecting the events.
+struct ScriptedController
+{
+    ButtonEventDetector detector;
+    std::vector<ButtonEvent> events;
+
+    void press(ControllerButton button, bool down)
+    {
+        vex::host::controller(vex::controllerType::primary).buttons[static_cast<std::size_t>(button)] = down;
+    }
+
+    void sampleUntil(std::uint32_t fromMs, std::uint32_t toMs)
+    {
+        for (std::uint32_t nowMs = fromMs; nowMs <= toMs; nowMs += 10)
+        {
+            detector.update(readButtons(primaryController), nowMs, 0, [this](const ButtonEvent &event)
+                            { events.push_back(event); });
+        }
+    }
+
+    std::size_t count(Type type) const
+    {
+        return std::ranges::count(events, type, &ButtonEvent::type);
+    }
+};
+
+TEST(detectorReportsPressAndRelease)
+{
+    ScriptedController controller;
+    controller.sampleUntil(0, 50);
+    CHECK(controller.events.empty());
+
+    controller.press(ControllerButton::A, true);
+    controller.sampleUntil(60, 200);
+    controller.press(ControllerButton::A, false);
+    controller.sampleUntil(210, 300);
+
+    CHECK(controller.events.size() == 2);
+    CHECK(controller.events[0].type == Type::Press);
+    CHECK(controller.events[0].button == ControllerButton::A);
+    CHECK(controller.events[0].timestampMs == 60);
+    CHECK(controller.events[1].type == Type::Release);
+    CHECK(controller.events[1].heldMs == 150);
+}
+
+TEST(detectorSendsOneLongPressAndTimedRepeats)
+{
+    ButtonEventDetector::Settings settings; // long press 1000 ms, repeat after 500 ms every 150 ms
+    ScriptedController controller{ButtonEventDetector(settings), {}};
+    controller.press(ControllerButton::Down, true);
+    controller.sampleUntil(0, 1200);
+    controller.press(ControllerButton::Down, false);
+    controller.sampleUntil(1210, 1300);
+
+    CHECK(controller.count(Type::Press) == 1);
+    CHECK(controller.count(Type::LongPress) == 1);
+    CHECK(controller.count(Type::Release) == 1);
+    // Repeats at 500, 650, 800, 950, 1100 ms.
+    CHECK(controller.count(Type::Repeat) == 5);
+    const auto longPress = std::ranges::find(controller.events, Type::LongPress, &ButtonEvent::type);
+    CHECK(longPress->timestampMs == 1000);
+    CHECK(longPress->heldMs == 1000);
+
+    // A second press gets its own long press.
+    controller.events.clear();
+    controller.press(ControllerButton::Down, true);
+    controller.sampleUntil(2000, 3100);
+    CHECK(controller.count(Type::LongPress) == 1);
+}
+
+TEST(detectorKeepsButtonsAndControllersApart)
+{
+    ButtonEventDetector detector;
+    std::vector<ButtonEvent> events;
+    auto collect = [&](const ButtonEvent &event)
+    { events.push_back(event); };
+    const std::uint16_t l1 = 1u << static_cast<int>(ControllerButton::L1);
+    const std::uint16_t r2 = 1u << static_cast<int>(ControllerButton::R2);
+
+    detector.update(l1 | r2, 0, 1, collect);
+    CHECK(events.size() == 2);
+    CHECK(events[0].button == ControllerButton::L1); // Button order.
+    CHECK(events[1].button == ControllerButton::R2);
+    CHECK(events[0].controllerIndex == 1);
+
+    detector.update(r2, 10, 1, collect);
+    CHECK(events.size() == 3);
+    CHECK(events[2].type == Type::Release);
+    CHECK(events[2].button == ControllerButton::L1);
+}
+
+TEST(readButtonsMapsEveryButtonToItsBit)
+{
+    auto &controller = vex::host::controller(vex::controllerType::primary);
+    for (std::size_t i = 0; i < controller.buttons.size(); ++i)
+    {
+        controller.buttons = {};
+        controller.buttons[i] = true;
+        CHECK(readButtons(primaryController) == (1u << i));
+        CHECK(isPressed(readButtons(primaryController), static_cast<ControllerButton>(i)));
+    }
+}
+
+TEST(eventQueueDropsWhenFullAndKeepsOrder)
+{
+    EventQueue<int, 4> queue;
+    CHECK(queue.empty());
+    for (int i = 0; i < 6; ++i)
+    {
+        queue.push(i);
+    }
+    CHECK(queue.getDropped() == 2);
+    int value = -1;
+    for (int i = 0; i < 4; ++i)
+    {
+        CHECK(queue.pop(value));
+        CHECK(value == i);
+    }
+    CHECK(!queue.pop(value));
+
+    queue.push(7);
+    queue.push(8);
+    queue.clear();
+    CHECK(queue.empty());
+    CHECK(queue.push(9));
+    CHECK(queue.pop(value) && value == 9);
+}
+
+TEST(eventQueuePassesEventsBetweenThreads)
+{
+    EventQueue<std::uint32_t, 64> queue;
+    constexpr std::uint32_t count = 200000;
+    std::thread producer([&]()
+                         {
+                             for (std::uint32_t i = 0; i < count;)
+                             {
+                                 if (queue.push(i))
+                                 {
+                                     ++i;
+                                 }
+                             } });
+    std::uint32_t expected = 0;
+    bool inOrder = true;
+    while (expected < count)
+    {
+        std::uint32_t value;
+        if (queue.pop(value))
+        {
+            inOrder = inOrder && value == expected;
+            ++expected;
+        }
+    }
+    producer.join();
+    CHECK(inOrder);
+}
+
+TEST(buttonServiceWaitForTimesOut)
+{
+    ButtonService service;
+    ButtonEvent event;
+    vex::timer waited;
+    CHECK(!service.waitFor(event, 50));
+    CHECK(waited.time() >= 50);
+    CHECK(waited.time() < 200);
+    CHECK(!service.poll(event));
+}
+
+static bool loggedOverlap()
+{
+    flushDeferredLogs();
+    return std::ranges::any_of(loggedMessages(), [](const LoggedMessage &message)
+                               { return message.message == "Two threads are reading button events at once."; });
+}
+
+TEST(buttonServiceRefusesASecondConsumer)
+{
+    ButtonService service;
+    std::thread waiter([&service]()
+                       {
+                           ButtonEvent event;
+                           service.waitFor(event, 300); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ButtonEvent event;
+    CHECK(!service.poll(event));
+    waiter.join();
+    CHECK(loggedOverlap());
+}
+
+TEST(diagnosticCheckLeavesTheQueueToTheDriveMenu)
+{
+    // The drive menu task waits on Buttons from the moment userControl starts; the diagnostic
+    // check runs meanwhile and must not read the same queue.
+    std::atomic<bool> menuRunning{true};
+    std::thread menu([&menuRunning]()
+                     {
+                         ButtonEvent event;
+                         while (menuRunning)
+                         {
+                             Buttons.waitFor(event, 20);
+                         } });
+
+    vex::host::competition().enabled = false;
+    vex::host::controller(vex::controllerType::primary).buttons[static_cast<std::size_t>(ControllerButton::Y)] = true;
+    vex::timer held;
+    CHECK(isDiagnosticMode());
+    CHECK(held.time() >= 1000);
+    CHECK(held.time() < 1900);
+
+    // Once enabled the check gives way at once.
+    vex::host::competition().enabled = true;
+    vex::timer enabled;
+    CHECK(!isDiagnosticMode());
+    CHECK(enabled.time() < 50);
+
+    menuRunning = false;
+    menu.join();
+    CHECK(!loggedOverlap());
+}
@@ -0,0 +1,184 @@
+#include "vex.h"
+#include "testing.h"
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+static void writeText(const char *name, const std::string &text)
+{
+    std::ofstream(name, std::ios::binary | std::ios::trunc) << text;
+}
+
+static std::string readText(const char *name)
+{
+    std::ifstream in(name, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+static void removeStoreFiles()
+{
+    std::filesystem::remove_all("store.cfg");
+    std::filesystem::remove_all("store.cfg.tmp");
+}
+
+TEST(applyEditsRewritesTopLevelLinesInPlace)
+{
+    const std::string text =
+        "# DRIVEMODE=Tank\n"
+        "  driveMode = LeftArcade\r\n"
+        "MOTOR_CONFIG {\n"
+        "    INERTIAL {\n"
+        "        PORT=4\n"
+        "    }\n"
+        "}\n"
+        "DRIVEMODE=Tank\n"
+        "SLEWRATE=3";
+    const ConfigFileStore::Edit edits[] = {{"DRIVEMODE", "SplitArcade"}, {"PORT", "9"}, {"LOGLEVEL", "Info"}};
+    CHECK(ConfigFileStore::applyEdits(text, edits) ==
+          "# DRIVEMODE=Tank\n"
+          "  driveMode =SplitArcade\r\n"
+          "MOTOR_CONFIG {\n"
+          "    INERTIAL {\n"
+          "        PORT=4\n"
+          "    }\n"
+          "}\n"
+          "SLEWRATE=3\n"
+          "PORT=9\n"
+          "LOGLEVEL=Info\n");
+}
+
+TEST(flushWritesStagedValues)
+{
+    removeStoreFiles();
+    writeText("store.cfg", "PRINTLOGO=true\nDRIVEMODE=Tank\n");
+    ConfigFileStore store("store.cfg");
+    store.set("DRIVEMODE", "LeftArcade", 1000);
+    CHECK(!store.isDue(2000));
+    CHECK(store.isDue(3000));
+
+    std::string written;
+    CHECK(store.flush(written));
+    CHECK(written == "PRINTLOGO=true\nDRIVEMODE=LeftArcade\n");
+    CHECK(readText("store.cfg") == written);
+    CHECK(!std::filesystem::exists("store.cfg.tmp"));
+    CHECK(!store.isDue(10000));
+}
+
+TEST(flushKeepsEditsWhenFileCannotBeRead)
+{
+    removeStoreFiles();
+    ConfigFileStore store("store.cfg");
+    store.set("DRIVEMODE", "Tank", 0);
+
+    // Missing file: nothing is created from the staged keys alone.
+    std::string written;
+    CHECK(!store.flush(written));
+    CHECK(!std::filesystem::exists("store.cfg"));
+    CHECK(store.isDue(ConfigFileStore::debounceMs));
+
+    // A file that opens but cannot be read.
+    std::filesystem::create_directory("store.cfg");
+    CHECK(!store.flush(written));
+    CHECK(std::filesystem::is_directory("store.cfg"));
+    CHECK(store.isDue(ConfigFileStore::debounceMs));
+    std::filesystem::remove("store.cfg");
+
+    // Once the file is back the staged value lands in it with the rest kept.
+    writeText("store.cfg", "PRINTLOGO=false\nDRIVEMODE=SplitArcade\n");
+    CHECK(store.flush(written));
+    CHECK(readText("store.cfg") == "PRINTLOGO=false\nDRIVEMODE=Tank\n");
+}
+
+TEST(recoverFinishesInterruptedSwap)
+{
+    removeStoreFiles();
+    ConfigFileStore store("store.cfg");
+
+    // Power lost while writing the temporary file: the config file is kept.
+    writeText("store.cfg", "DRIVEMODE=Tank\n");
+    writeText("store.cfg.tmp", "DRIVEMO");
+    store.recover();
+    CHECK(readText("store.cfg") == "DRIVEMODE=Tank\n");
+    CHECK(!std::filesystem::exists("store.cfg.tmp"));
+
+    // Power lost between removing the config file and the rename.
+    std::filesystem::remove("store.cfg");
+    writeText("store.cfg.tmp", "DRIVEMODE=LeftArcade\n");
+    store.recover();
+    CHECK(readText("store.cfg") == "DRIVEMODE=LeftArcade\n");
+    CHECK(!std::filesystem::exists("store.cfg.tmp"));
+}
+
+TEST(recoverKeepsTemporaryFileOnBadRead)
+{
+    removeStoreFiles();
+    std::filesystem::create_directory("store.cfg");
+    writeText("store.cfg.tmp", "DRIVEMODE=Tank\n");
+    ConfigFileStore store("store.cfg");
+    store.recover();
+    CHECK(readText("store.cfg.tmp") == "DRIVEMODE=Tank\n");
+    removeStoreFiles();
+}
+
+// Top-level KEY=VALUE lines, as the parser counts keys.
+static std::size_t countTopLevelKeys(const std::string &text)
+{
+    std::size_t keys = 0;
+    std::size_t depth = 0;
+    std::istringstream lines(text);
+    for (std::string line; std::getline(lines, line);)
+    {
+        if (line.find('{') != std::string::npos)
+        {
+            ++depth;
+        }
+        else if (line.find('}') != std::string::npos)
+        {
+            --depth;
+        }
+        else if (depth == 0 && line.find('=') != std::string::npos && line.find('#') == std::string::npos)
+        {
+            ++keys;
+        }
+    }
+    return keys;
+}
+
+TEST(repeatedBootsKeepTheConfigFileSize)
+{
+    removeStoreFiles();
+    std::filesystem::remove("config.bin");
+    const std::string text =
+        "# Config File:\n"
+        "MOTOR_CONFIG {\n"
+        "    FRONT_LEFT_MOTOR {\n"
+        "        PORT=1\n"
+        "        GEAR_RATIO=6_1\n"
+        "        REVERSED=false\n"
+        "    }\n"
+        "}\n"
+        "POLLINGRATE=20\n"
+        "DRIVEMODE=LeftArcade\n"
+        "SLEWRATE=12\n"
+        "TEAMNUMBER=1234A\n";
+    writeText("store.cfg", text);
+    const std::size_t sizeWithoutMode = text.size() - std::string_view("LeftArcade").size();
+    const std::size_t keys = countTopLevelKeys(text);
+
+    // Boot, change the drive mode from the menu, let the watcher write it back; twenty times over.
+    for (int boot = 0; boot < 20; ++boot)
+    {
+        configManager config("store.cfg", "store_maintenance.txt");
+        config.parseConfig();
+        const bool tank = config.getDriveMode() != configManager::DriveMode::Tank;
+        config.setDriveMode(tank ? configManager::DriveMode::Tank : configManager::DriveMode::SplitArcade);
+        CHECK(config.writeBackSettings(vex::timer::system() + ConfigFileStore::debounceMs));
+
+        const std::string written = readText("store.cfg");
+        CHECK(written.size() == sizeWithoutMode + std::string_view(tank ? "Tank" : "SplitArcade").size());
+        CHECK(countTopLevelKeys(written) == keys);
+        CHECK(written.find(tank ? "DRIVEMODE=Tank\n" : "DRIVEMODE=SplitArcade\n") != std::string::npos);
+    }
+    removeStoreFiles();
+}
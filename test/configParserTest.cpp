@@ -0,0 +1,106 @@
+#include "vex.h"
+#include "testing.h"
+#include <chrono>
+
+// Each test parses into its own configManager, so ConfigManager is never touched. Checks of the
+// device table boot from the text, since it is published with the live settings.
+
+TEST(parserAppliesKeysFieldsAndBlocks)
+{
+    configManager config("parser.cfg", "parser_maintenance.txt");
+    const std::string text =
+        "# comment\n"
+        "  polLingRate = 7\n"
+        "DRIVEMODE=Tank\n"
+        "TEAMNUMBER=99\n"
+        "\n"
+        "MOTOR_CONFIG {\n"
+        "    FRONT_LEFT_MOTOR\n"
+        "    {\n"
+        "        PORT = 5\n"
+        "        GEAR_RATIO = 18_1\n"
+        "        REVERSED = true\n"
+        "    }\n"
+        "}\n";
+    CHECK(bootFromText(config, "parser.cfg", text));
+    CHECK(config.getPollingRate() == 7);
+    CHECK(config.getDriveMode() == configManager::DriveMode::Tank);
+    CHECK(config.getTeamNumber() == "99");
+    const configManager::DeviceConfig motor = config.getDeviceConfig(configManager::Device::FrontLeftMotor);
+    CHECK(motor.port == 5);
+    CHECK(motor.gearSetting == vex::gearSetting::ratio18_1);
+    CHECK(motor.reversed);
+}
+
+TEST(parserReportsLineAndColumn)
+{
+    configManager config("parser.cfg", "parser_maintenance.txt");
+    CHECK(!config.setValuesFromConfig("PRINTLOGO=true\n\n   NOSUCHKEY=1\nMOTOR_CONFIG {\n  INERTIAL {\n\tSPEED = 3\n  }\n}\n"));
+    bool unknownKey = false;
+    bool unknownField = false;
+    for (const LoggedMessage &message : loggedMessages())
+    {
+        unknownKey |= message.message.find("NOSUCHKEY (line 3, column 4)") != std::string::npos;
+        unknownField |= message.message.find("SPEED (line 6, column 2)") != std::string::npos;
+    }
+    CHECK(unknownKey);
+    CHECK(unknownField);
+    // The block closes without a PORT, reported where it closes.
+    CHECK(loggedMessages().size() == 3);
+    CHECK(loggedMessages().back().message.find("(line 7, column 3)") != std::string::npos);
+}
+
+// A large synthetic config: a typical file repeated to about `minLines` lines.
+static std::string syntheticConfig(std::size_t minLines)
+{
+    const std::string block =
+        "# Config File:\n"
+        "PRINTLOGO=true\n"
+        "LOGTOFILE=false\n"
+        "MAXOPTIONSSIZE=4\n"
+        "POLLINGRATE=5\n"
+        "CTRLR1POLLINGRATE=25\n"
+        "DRIVEMODE=SplitArcade\n"
+        "SLEWRATE=30\n"
+        "INPUTEXPO=0.5\n"
+        "LEFTDEADZONE=10\n"
+        "RIGHTDEADZONE=12\n"
+        "VELKS=0.3\n"
+        "VELKP=0.04\n"
+        "DRIVECURRENTBUDGET=8\n"
+        "MOTOR_CONFIG {\n"
+        "    FRONT_LEFT_MOTOR {\n"
+        "        PORT = 1\n"
+        "        GEAR_RATIO = 6_1\n"
+        "        REVERSED = false\n"
+        "    }\n"
+        "}\n";
+    const std::size_t blockLines = std::ranges::count(block, '\n');
+    std::string text;
+    for (std::size_t lines = 0; lines < minLines; lines += blockLines)
+    {
+        text += block;
+    }
+    return text;
+}
+
+TEST(parserBenchmarkOnALargeConfig)
+{
+    configManager config("parser.cfg", "parser_maintenance.txt");
+    const std::string text = syntheticConfig(20000);
+    const std::size_t lines = std::ranges::count(text, '\n');
+
+    constexpr int runs = 5;
+    double bestMs = 1e9;
+    for (int run = 0; run < runs; ++run)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        const bool parsed = config.setValuesFromConfig(text);
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        bestMs = std::min(bestMs, ms);
+        CHECK(parsed);
+    }
+    std::printf("  %zu lines (%zu KB) in %.2f ms, %.0f ns per line\n", lines, text.size() / 1024, bestMs, bestMs * 1e6 / lines);
+    // Loose bound so a slow host does not fail the suite; the printed figure is the benchmark.
+    CHECK(bestMs < 1000);
+}
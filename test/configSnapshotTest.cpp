@@ -0,0 +1,288 @@
+#include "vex.h"
+#include "testing.h"
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+// parseConfig() keeps its snapshot in config.bin next to the config file; each test starts without one.
+
+static const char *snapshotFile = "config.bin";
+
+static void writeFile(const char *name, const std::string &text)
+{
+    std::ofstream(name, std::ios::binary | std::ios::trunc) << text;
+}
+
+static const std::string snapshotConfig =
+    "POLLINGRATE=7\n"
+    "DRIVEMODE=Tank\n"
+    "TEAMNUMBER=42\n"
+    "LEFTDEADZONE=4\n"
+    "MOTOR_CONFIG {\n"
+    "    REAR_RIGHT_MOTOR {\n"
+    "        PORT = 9\n"
+    "        GEAR_RATIO = 36_1\n"
+    "        REVERSED = true\n"
+    "    }\n"
+    "}\n";
+
+static bool loggedSnapshotLoad()
+{
+    for (const LoggedMessage &message : loggedMessages())
+    {
+        if (message.message == "Loaded config snapshot.")
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void checkSnapshotValues(const configManager &config)
+{
+    CHECK(config.getPollingRate() == 7);
+    CHECK(config.getDriveMode() == configManager::DriveMode::Tank);
+    CHECK(config.getTeamNumber() == "42");
+    CHECK(config.getLeftDeadzone() == 4);
+    const configManager::DeviceConfig motor = config.getDeviceConfig(configManager::Device::RearRightMotor);
+    CHECK(motor.port == 9);
+    CHECK(motor.gearSetting == vex::gearSetting::ratio36_1);
+    CHECK(motor.reversed);
+}
+
+TEST(snapshotRoundTripSkipsParser)
+{
+    std::filesystem::remove(snapshotFile);
+    writeFile("snapshot.cfg", snapshotConfig);
+
+    configManager first("snapshot.cfg", "snapshot_maintenance.txt");
+    first.parseConfig();
+    CHECK(!loggedSnapshotLoad());
+    CHECK(std::filesystem::exists(snapshotFile));
+    checkSnapshotValues(first);
+
+    clearLoggedMessages();
+    configManager second("snapshot.cfg", "snapshot_maintenance.txt");
+    second.parseConfig();
+    CHECK(loggedSnapshotLoad());
+    checkSnapshotValues(second);
+}
+
+TEST(snapshotWithBadChecksumIsReparsed)
+{
+    std::filesystem::remove(snapshotFile);
+    writeFile("snapshot.cfg", snapshotConfig);
+    configManager first("snapshot.cfg", "snapshot_maintenance.txt");
+    first.parseConfig();
+
+    // Flip a byte of the settings, past the header.
+    {
+        std::fstream file(snapshotFile, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekg(60);
+        const char byte = static_cast<char>(file.get() ^ 0x5a);
+        file.seekp(60);
+        file.put(byte);
+    }
+
+    clearLoggedMessages();
+    configManager second("snapshot.cfg", "snapshot_maintenance.txt");
+    second.parseConfig();
+    CHECK(!loggedSnapshotLoad());
+    bool corruptReported = false;
+    for (const LoggedMessage &message : loggedMessages())
+    {
+        corruptReported |= message.functionName == "configManager::loadSnapshot" && message.level == Log::Level::Warn;
+    }
+    CHECK(corruptReported);
+    checkSnapshotValues(second);
+
+    // The reparse rewrote a good snapshot.
+    clearLoggedMessages();
+    configManager third("snapshot.cfg", "snapshot_maintenance.txt");
+    third.parseConfig();
+    CHECK(loggedSnapshotLoad());
+    checkSnapshotValues(third);
+}
+
+TEST(snapshotOfOtherTextIsIgnored)
+{
+    std::filesystem::remove(snapshotFile);
+    writeFile("snapshot.cfg", snapshotConfig);
+    configManager first("snapshot.cfg", "snapshot_maintenance.txt");
+    first.parseConfig();
+
+    writeFile("snapshot.cfg", snapshotConfig + "POLLINGRATE=9\n");
+    clearLoggedMessages();
+    configManager second("snapshot.cfg", "snapshot_maintenance.txt");
+    second.parseConfig();
+    CHECK(!loggedSnapshotLoad());
+    CHECK(second.getPollingRate() == 9);
+    for (const LoggedMessage &message : loggedMessages())
+    {
+        CHECK(message.level < Log::Level::Warn);
+    }
+}
+
+TEST(truncatedSnapshotIsIgnored)
+{
+    std::filesystem::remove(snapshotFile);
+    writeFile("snapshot.cfg", snapshotConfig);
+    configManager first("snapshot.cfg", "snapshot_maintenance.txt");
+    first.parseConfig();
+    std::filesystem::resize_file(snapshotFile, std::filesystem::file_size(snapshotFile) - 8);
+
+    clearLoggedMessages();
+    configManager second("snapshot.cfg", "snapshot_maintenance.txt");
+    second.parseConfig();
+    CHECK(!loggedSnapshotLoad());
+    checkSnapshotValues(second);
+}
+
+static bool sameValue(const ConfigField &field, const ConfigValue &a, const ConfigValue &b)
+{
+    switch (field.type)
+    {
+    case ConfigValueType::Bool:
+        return a.flag == b.flag;
+    case ConfigValueType::Integer:
+        return a.integer == b.integer;
+    case ConfigValueType::Number:
+        return a.number == b.number;
+    case ConfigValueType::Text:
+        return a.text == b.text;
+    case ConfigValueType::Choice:
+        return a.choice == b.choice;
+    case ConfigValueType::Version:
+        break;
+    }
+    return true;
+}
+
+// A value for every setting that is valid but not its default, so a setting the snapshot lost
+// would come back different.
+static std::string nonDefaultValue(const ConfigField &field)
+{
+    switch (field.type)
+    {
+    case ConfigValueType::Bool:
+        return field.defaultValue == "true" ? "false" : "true";
+    case ConfigValueType::Integer:
+    case ConfigValueType::Number:
+        return std::format("{}", std::format("{}", field.max) == field.defaultValue ? field.min : field.max);
+    case ConfigValueType::Text:
+        return std::string("abcdefghijklmnopqrst").substr(0, static_cast<std::size_t>(field.max));
+    case ConfigValueType::Choice:
+        for (const ConfigChoice &choice : field.choices)
+        {
+            if (choice.name != field.defaultValue)
+            {
+                return std::string(choice.name);
+            }
+        }
+        break;
+    case ConfigValueType::Version:
+        return Version;
+    }
+    return std::string(field.defaultValue);
+}
+
+TEST(snapshotRestoresEverySchemaSetting)
+{
+    std::filesystem::remove(snapshotFile);
+    std::string text;
+    for (const ConfigField &field : configManager::getSchema())
+    {
+        if (!field.alias)
+        {
+            text += std::format("{}={}\n", field.key, nonDefaultValue(field));
+        }
+    }
+    writeFile("snapshot.cfg", text);
+
+    configManager parsed("snapshot.cfg", "snapshot_maintenance.txt");
+    parsed.parseConfig();
+    CHECK(std::filesystem::exists(snapshotFile));
+    clearLoggedMessages();
+    configManager restored("snapshot.cfg", "snapshot_maintenance.txt");
+    restored.parseConfig();
+    CHECK(loggedSnapshotLoad());
+
+    const configManager defaults("defaults.cfg", configManager::ParseOnly{});
+    std::size_t checked = 0;
+    for (const ConfigField &field : configManager::getSchema())
+    {
+        if (field.alias || field.read == nullptr)
+        {
+            continue;
+        }
+        ConfigValue fromText, fromSnapshot, byDefault;
+        field.read(parsed, fromText);
+        field.read(restored, fromSnapshot);
+        field.read(defaults, byDefault);
+        if (sameValue(field, fromText, byDefault))
+        {
+            reportFailure(__FILE__, __LINE__, std::format("{} was not set away from its default", field.key));
+        }
+        if (!sameValue(field, fromText, fromSnapshot))
+        {
+            reportFailure(__FILE__, __LINE__, std::format("{} did not survive the snapshot", field.key));
+        }
+        ++checked;
+    }
+    CHECK(checked > 25);
+}
+
+// The default config file as resetOrInitializeConfig() writes it: default devices, then every key.
+static std::string defaultConfigText()
+{
+    const configManager defaults("defaults.cfg", configManager::ParseOnly{});
+    configManager::DeviceTable devices;
+    for (std::size_t i = 0; i < devices.size(); ++i)
+    {
+        devices[i] = defaults.getDeviceConfig(static_cast<configManager::Device>(i));
+    }
+    std::ostringstream text;
+    configManager::writeDeviceConfig(text, devices);
+    for (const ConfigField &field : configManager::getSchema())
+    {
+        if (!field.alias)
+        {
+            text << "    " << field.key << '=' << (field.type == ConfigValueType::Version ? std::string_view(Version) : field.defaultValue) << '\n';
+        }
+    }
+    return text.str();
+}
+
+TEST(snapshotBootBenchmark)
+{
+    writeFile("snapshot.cfg", defaultConfigText());
+    constexpr int boots = 200;
+
+    // The whole boot-time config step, parseConfig(), with and without a snapshot to start from.
+    auto bootMicroseconds = [&](bool fromSnapshot)
+    {
+        double totalUs = 0;
+        for (int boot = 0; boot < boots; ++boot)
+        {
+            if (!fromSnapshot)
+            {
+                std::filesystem::remove(snapshotFile);
+            }
+            configManager config("snapshot.cfg", "snapshot_maintenance.txt");
+            clearLoggedMessages();
+            const auto start = std::chrono::steady_clock::now();
+            config.parseConfig();
+            totalUs += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+            CHECK(loggedSnapshotLoad() == fromSnapshot);
+        }
+        return totalUs / boots;
+    };
+    const double parseUs = bootMicroseconds(false);
+    const double snapshotUs = bootMicroseconds(true);
+    std::printf("  parseConfig: %.0f us per boot parsing the text and writing the snapshot, %.0f us from the snapshot\n", parseUs, snapshotUs);
+    // Loose bounds so a slow host does not fail the suite; the printed figures are the benchmark.
+    CHECK(parseUs < 50000);
+    CHECK(snapshotUs < 50000);
+}
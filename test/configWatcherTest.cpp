@@ -0,0 +1,73 @@
+#include "vex.h"
+#include "testing.h"
+#include <filesystem>
+#include <fstream>
+
+static void writeText(const char *name, const std::string &text)
+{
+    std::ofstream(name, std::ios::binary | std::ios::trunc) << text;
+}
+
+TEST(parseOnlyManagerSkipsMaintenanceData)
+{
+    std::filesystem::remove("maint_a.jnl");
+    std::filesystem::remove("maint_b.jnl");
+    writeText("watch_maintenance.txt", "ODOMETER=500\nLAST_SERVICE=100\n");
+
+    configManager full("watch.cfg", "watch_maintenance.txt");
+    CHECK(full.getOdometer() == 500);
+
+    configManager parseOnly("watch.cfg", configManager::ParseOnly{});
+    CHECK(parseOnly.getOdometer() == 0);
+    CHECK(parseOnly.getLastService() == 0);
+    CHECK(!std::filesystem::exists("maint_a.jnl"));
+    CHECK(!std::filesystem::exists("maint_b.jnl"));
+}
+
+TEST(reloadPublishesChangedLiveSettings)
+{
+    configManager config("watch.cfg", configManager::ParseOnly{});
+    const std::uint32_t revision = config.getLiveRevision();
+
+    writeText("watch.cfg", "LEFTDEADZONE=3\nSLEWRATE=20\n");
+    CHECK(config.reloadConfig());
+    CHECK(config.getLiveRevision() == revision + 1);
+    CHECK(config.getLeftDeadzone() == 3);
+    CHECK_NEAR(config.getSlewRate(), 20, 1e-9);
+
+    // Same text: nothing to publish.
+    CHECK(!config.reloadConfig());
+
+    // A broken file keeps the running settings and is reported once.
+    writeText("watch.cfg", "LEFTDEADZONE=oops\n");
+    CHECK(!config.reloadConfig());
+    CHECK(config.getLeftDeadzone() == 3);
+    CHECK(config.getLiveRevision() == revision + 1);
+    CHECK(!config.reloadConfig());
+}
+
+TEST(liveSettingsReadDuringPublishAreConsistent)
+{
+    configManager config("watch.cfg", configManager::ParseOnly{});
+    writeText("watch.cfg", "VELKP=0\nVELKI=0\n");
+    CHECK(config.reloadConfig());
+    std::atomic<bool> done{false};
+    std::atomic<int> torn{0};
+    std::thread reader([&]()
+                       {
+                           while (!done.load())
+                           {
+                               // Every file sets kP and kI to the same value.
+                               const configManager::VelocityGains gains = config.getVelocityGains();
+                               torn += gains.kP != gains.kI ? 1 : 0;
+                           } });
+    for (int i = 1; i <= 200; ++i)
+    {
+        writeText("watch.cfg", std::format("VELKP={}\nVELKI={}\n", i / 1000.0, i / 1000.0));
+        CHECK(config.reloadConfig());
+    }
+    done = true;
+    reader.join();
+    CHECK(torn == 0);
+    CHECK_NEAR(config.getVelocityGains().kP, 0.2, 1e-9);
+}
@@ -0,0 +1,94 @@
+#include "vex.h"
+#include "testing.h"
+#include <sstream>
+
+using Device = configManager::Device;
+
+static std::size_t index(Device device)
+{
+    return static_cast<std::size_t>(device);
+}
+
+static bool sameDevice(const configManager::DeviceConfig &a, const configManager::DeviceConfig &b)
+{
+    return a.port == b.port && a.gearSetting == b.gearSetting && a.reversed == b.reversed;
+}
+
+TEST(deviceTableRoundTripsThroughText)
+{
+    configManager::DeviceTable table;
+    table[index(Device::FrontLeftMotor)] = {3, vex::gearSetting::ratio36_1, true};
+    table[index(Device::FrontRightMotor)] = {21, vex::gearSetting::ratio18_1, false};
+    table[index(Device::RearLeftMotor)] = {1, vex::gearSetting::ratio6_1, false};
+    table[index(Device::RearRightMotor)] = {14, vex::gearSetting::ratio6_1, true};
+    table[index(Device::Inertial)] = {7, vex::gearSetting::ratio18_1, false};
+    table[index(Device::RearBumper)] = {5, vex::gearSetting::ratio18_1, false}; // three-wire F
+
+    std::ostringstream text;
+    configManager::writeDeviceConfig(text, table);
+    CHECK(text.str().find("PORT=F") != std::string::npos);
+
+    configManager config("devices.cfg", "devices_maintenance.txt");
+    CHECK(bootFromText(config, "devices.cfg", text.str()));
+    for (std::size_t i = 0; i < table.size(); ++i)
+    {
+        const configManager::DeviceConfig parsed = config.getDeviceConfig(static_cast<Device>(i));
+        if (i == index(Device::Inertial) || i == index(Device::RearBumper))
+        {
+            CHECK(parsed.port == table[i].port);
+        }
+        else
+        {
+            CHECK(sameDevice(parsed, table[i]));
+        }
+    }
+}
+
+TEST(deviceNamesResolveOnceIgnoringCase)
+{
+    CHECK(configManager::deviceName(Device::FrontLeftMotor) == "FRONT_LEFT_MOTOR");
+    CHECK(configManager::deviceName(Device::RearBumper) == "REAR_BUMPER");
+
+    configManager config("devices.cfg", "devices_maintenance.txt");
+    CHECK(bootFromText(config, "devices.cfg", "MOTOR_CONFIG {\n  rear_left_motor {\n    PORT=12\n    GEAR_RATIO=36_1\n  }\n}\n"));
+    const configManager::DeviceConfig motor = config.getDeviceConfig(Device::RearLeftMotor);
+    CHECK(motor.port == 12);
+    CHECK(motor.gearSetting == vex::gearSetting::ratio36_1);
+}
+
+TEST(badDeviceBlockKeepsPreviousPlacement)
+{
+    configManager config("devices.cfg", "devices_maintenance.txt");
+    const configManager::DeviceConfig before = config.getDeviceConfig(Device::FrontRightMotor);
+    CHECK(!bootFromText(config, "devices.cfg", "MOTOR_CONFIG {\n  FRONT_RIGHT_MOTOR {\n    PORT=30\n  }\n}\n"));
+    CHECK(sameDevice(config.getDeviceConfig(Device::FrontRightMotor), before));
+    CHECK(!bootFromText(config, "devices.cfg", "MOTOR_CONFIG {\n  FRONT_RIGHT_MOTOR {\n    PORT=4\n    GEAR_RATIO=12_1\n  }\n}\n"));
+    CHECK(sameDevice(config.getDeviceConfig(Device::FrontRightMotor), before));
+}
+
+TEST(deviceFieldsResolveThroughTheIndex)
+{
+    configManager::DeviceFieldKey field{};
+    CHECK(configManager::findDeviceField("PORT", field) && field == configManager::DeviceFieldKey::Port);
+    CHECK(configManager::findDeviceField("gear_ratio", field) && field == configManager::DeviceFieldKey::GearRatio);
+    CHECK(configManager::findDeviceField("Reversed", field) && field == configManager::DeviceFieldKey::Reversed);
+    CHECK(!configManager::findDeviceField("PORTS", field));
+    CHECK(!configManager::findDeviceField("", field));
+
+    configManager config("devices.cfg", "devices_maintenance.txt");
+    CHECK(bootFromText(config, "devices.cfg", "MOTOR_CONFIG {\n  FRONT_LEFT_MOTOR {\n    port=9\n    Gear_Ratio=18_1\n    reversed=true\n  }\n}\n"));
+    const configManager::DeviceConfig motor = config.getDeviceConfig(Device::FrontLeftMotor);
+    CHECK(motor.port == 9);
+    CHECK(motor.gearSetting == vex::gearSetting::ratio18_1);
+    CHECK(motor.reversed);
+
+    const configManager::DeviceConfig before = config.getDeviceConfig(Device::RearLeftMotor);
+    CHECK(!bootFromText(config, "devices.cfg", "MOTOR_CONFIG {\n  REAR_LEFT_MOTORS {\n    PORT=2\n  }\n}\n"));
+    CHECK(sameDevice(config.getDeviceConfig(Device::RearLeftMotor), before));
+    bool unknownDevice = false;
+    for (const LoggedMessage &message : loggedMessages())
+    {
+        unknownDevice |= message.message.find("Unknown device REAR_LEFT_MOTORS") != std::string::npos;
+    }
+    CHECK(unknownDevice);
+}
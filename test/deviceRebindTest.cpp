@@ -0,0 +1,106 @@
+#include "vex.h"
+#include "testing.h"
+#include <atomic>
+#include <fstream>
+#include <thread>
+
+static void writeMotorPort(const char *name, int frontLeftPort)
+{
+    std::ofstream file(name, std::ios::binary | std::ios::trunc);
+    file << "MOTOR_CONFIG {\n    FRONT_LEFT_MOTOR {\n        PORT = " << frontLeftPort << "\n        GEAR_RATIO = 6_1\n    }\n}\n";
+}
+
+TEST(portChangeInConfigRebindsMotor)
+{
+    using Device = configManager::Device;
+    Devices.begin();
+    const int bootPort = Devices.motor(Device::FrontLeftMotor).index() + 1;
+
+    configManager config("rebind.cfg", "rebind_maintenance.txt");
+    writeMotorPort("rebind.cfg", bootPort);
+    config.reloadConfig();
+    config.updateOdometer(1000);
+    const int odometerBefore = config.getOdometer();
+
+    const Pose pose{0.5, -0.25, 1.0};
+    DriveOdometry.reset(pose);
+    DriveOdometry.update(0, 0, 0, 0.01);
+    const std::uint32_t generation = Devices.getGeneration();
+
+    const int newPort = bootPort == 5 ? 6 : 5;
+    writeMotorPort("rebind.cfg", newPort);
+    CHECK(config.reloadConfig());
+    CHECK(Devices.getGeneration() == generation + 1);
+    CHECK(Devices.motor(Device::FrontLeftMotor).index() == newPort - 1);
+    CHECK(config.getDeviceConfig(Device::FrontLeftMotor).port == newPort);
+    CHECK(vex::host::motor(bootPort - 1).stopCalls > 0);
+
+    // The new motor reads from its own zero: no travel on the odometer, no jump in the pose.
+    config.updateOdometer(-3000);
+    CHECK(config.getOdometer() == odometerBefore);
+    config.updateOdometer(-2900);
+    CHECK(config.getOdometer() == odometerBefore + 100);
+
+    CHECK(DriveOdometry.isResetPending());
+    DriveOdometry.update(-7, 3, 0, 0.01);
+    CHECK_NEAR(DriveOdometry.getPose().x, pose.x, 1e-9);
+    CHECK_NEAR(DriveOdometry.getPose().y, pose.y, 1e-9);
+    CHECK_NEAR(DriveOdometry.getPose().theta, pose.theta, 1e-9);
+
+    // An unrelated edit moves nothing.
+    std::ofstream("rebind.cfg", std::ios::app) << "LEFTDEADZONE=3\n";
+    CHECK(config.reloadConfig());
+    CHECK(Devices.getGeneration() == generation + 1);
+
+    // Put the motor back for the other tests, after the registry's rebind interval.
+    vex::this_thread::sleep_for(300);
+    writeMotorPort("rebind.cfg", bootPort);
+    CHECK(config.reloadConfig());
+    CHECK(Devices.motor(Device::FrontLeftMotor).index() == bootPort - 1);
+}
+
+TEST(reloadPublishesOnlyMovedPorts)
+{
+    using Device = configManager::Device;
+    Devices.begin();
+    const int bootPort = Devices.motor(Device::FrontLeftMotor).index() + 1;
+    vex::this_thread::sleep_for(300); // The registry's rebind interval, after the previous test
+
+    configManager config("rebind.cfg", configManager::ParseOnly{});
+    writeMotorPort("rebind.cfg", bootPort);
+    config.reloadConfig();
+    const configManager::DeviceConfig before = config.getDeviceConfig(Device::FrontLeftMotor);
+    const int inertialPort = config.getDeviceConfig(Device::Inertial).port;
+
+    // Readers see the old or the new table, never a mix, and never the file's gear ratio.
+    const int newPort = bootPort == 5 ? 6 : 5;
+    std::atomic<bool> done{false};
+    std::atomic<int> unexpected{0};
+    std::thread reader([&]()
+                       {
+                           while (!done.load())
+                           {
+                               const configManager::DeviceConfig motor = config.getDeviceConfig(Device::FrontLeftMotor);
+                               unexpected += (motor.port != bootPort && motor.port != newPort) || motor.gearSetting != before.gearSetting ? 1 : 0;
+                           } });
+    std::ofstream("rebind.cfg", std::ios::binary | std::ios::trunc)
+        << "MOTOR_CONFIG {\n    FRONT_LEFT_MOTOR {\n        PORT = " << newPort << "\n        GEAR_RATIO = 36_1\n        REVERSED = "
+        << (before.reversed ? "false" : "true") << "\n    }\n    INERTIAL {\n        PORT = " << (inertialPort == 12 ? 13 : 12) << "\n    }\n}\n";
+    CHECK(config.reloadConfig());
+    done = true;
+    reader.join();
+    CHECK(unexpected == 0);
+
+    // The port moved; the gear ratio, reversal and sensor wait for a restart.
+    const configManager::DeviceConfig after = config.getDeviceConfig(Device::FrontLeftMotor);
+    CHECK(after.port == newPort);
+    CHECK(after.gearSetting == before.gearSetting);
+    CHECK(after.reversed == before.reversed);
+    CHECK(config.getDeviceConfig(Device::Inertial).port == inertialPort);
+    CHECK(Devices.motor(Device::FrontLeftMotor).index() == newPort - 1);
+
+    vex::this_thread::sleep_for(300);
+    writeMotorPort("rebind.cfg", bootPort);
+    CHECK(config.reloadConfig());
+    CHECK(Devices.motor(Device::FrontLeftMotor).index() == bootPort - 1);
+}
@@ -0,0 +1,134 @@
+#ifndef DRIVETRAIN_SIM_H
+#define DRIVETRAIN_SIM_H
+
+/**
+ * @class DrivetrainSim
+ * @brief Four-wheel skid-steer drivetrain for the host tests.
+ *
+ * Each wheel is a V5 motor (linear torque-speed curve) driving an inertia through a tyre whose
+ * grip rises to a peak at peakSlip and falls to a sliding value when the wheel spins or locks.
+ * The chassis integrates the tyre forces forward and in yaw, with scrub damping the rotation.
+ * step() advances in small substeps, so a controller can run at its own tick on top of it.
+ */
+class DrivetrainSim
+{
+public:
+    struct Settings
+    {
+        double massKg = 7;
+        double wheelTravelMeters = wheelTravelMm / 1000.0;
+        double trackWidthMeters = trackWidthMm / 1000.0;
+        double freeRpm = 200;          ///< Wheel speed at 12 V with no load.
+        double stallTorqueNm = 2.1;    ///< Wheel torque at 12 V and standstill.
+        double stallAmps = 2.5;
+        double wheelInertia = 0.003;   ///< kg m^2 at the wheel, motor included.
+        double yawInertia = 0.12;      ///< kg m^2.
+        double yawDamping = 0.8;       ///< Nm per rad/s of scrub.
+        double peakGrip = 1.0;         ///< Friction coefficient at peakSlip.
+        double slidingGrip = 0.7;      ///< Friction coefficient of a spinning or locked tyre.
+        double peakSlip = 0.15;
+        double substepSeconds = 0.0001;
+    };
+
+    DrivetrainSim() = default;
+    explicit DrivetrainSim(const Settings &settings) : settings(settings) {}
+
+    void setSpeed(double metersPerSecond)
+    {
+        speed = metersPerSecond;
+        for (double &wheelSpeed : wheelSpeeds)
+        {
+            wheelSpeed = metersPerSecond;
+        }
+    }
+
+    /**
+     * @brief Advances the simulation with the given motor voltages held for `seconds`.
+     *
+     * @param yawDisturbanceNm Extra torque on the chassis, e.g. a bump or a pushing robot.
+     */
+    void step(const WheelVolts &volts, double seconds, double yawDisturbanceNm = 0)
+    {
+        const double radius = settings.wheelTravelMeters / (2 * M_PI);
+        const double freeSpeed = settings.freeRpm / 60 * settings.wheelTravelMeters;
+        const double normalForce = settings.massKg * 9.80665 / WheelCount;
+        const double halfTrack = settings.trackWidthMeters / 2;
+
+        for (double t = 0; t < seconds - 1e-12; t += settings.substepSeconds)
+        {
+            const double dt = std::min(settings.substepSeconds, seconds - t);
+            double totalForce = 0;
+            double yawTorque = yawDisturbanceNm;
+            for (std::size_t i = 0; i < WheelCount; ++i)
+            {
+                const double ground = speed + (isLeftWheel(i) ? 1 : -1) * yawRate * halfTrack;
+                const double difference = wheelSpeeds[i] - ground;
+                const double reference = std::max({std::abs(wheelSpeeds[i]), std::abs(ground), 0.05});
+                const double tyreForce = grip(std::abs(difference) / reference) * normalForce * (difference > 0 ? 1 : -1);
+
+                const double motorFraction = std::clamp(volts.volts[i], -12.0, 12.0) / 12 - wheelSpeeds[i] / freeSpeed;
+                currents[i] = settings.stallAmps * std::abs(motorFraction);
+                const double wheelTorque = settings.stallTorqueNm * motorFraction - tyreForce * radius;
+                wheelSpeeds[i] += wheelTorque / settings.wheelInertia * radius * dt;
+
+                totalForce += tyreForce;
+                yawTorque += (isLeftWheel(i) ? 1 : -1) * tyreForce * halfTrack;
+            }
+            yawTorque -= settings.yawDamping * yawRate;
+
+            acceleration = totalForce / settings.massKg;
+            speed += acceleration * dt;
+            position += speed * dt;
+            yawRate += yawTorque / settings.yawInertia * dt;
+            heading += yawRate * dt;
+        }
+    }
+
+    /**
+     * @brief The sensor frame the robot would read now.
+     */
+    SensorFrame frame() const
+    {
+        SensorFrame frame;
+        for (std::size_t i = 0; i < WheelCount; ++i)
+        {
+            frame.wheels[i].velocityRpm = wheelSpeeds[i] / settings.wheelTravelMeters * 60;
+            frame.wheels[i].currentAmps = currents[i];
+        }
+        frame.forwardAccelG = acceleration / 9.80665;
+        frame.yawRateDps = yawRate * 180 / M_PI;
+        frame.rotationDeg = heading * 180 / M_PI;
+        return frame;
+    }
+
+    /// @brief Slip of a wheel against the ground under it: 0 rolling, 1 locked or spinning on the spot.
+    double wheelSlip(std::size_t wheel) const
+    {
+        const double ground = speed + (isLeftWheel(wheel) ? 1 : -1) * yawRate * settings.trackWidthMeters / 2;
+        const double reference = std::max({std::abs(wheelSpeeds[wheel]), std::abs(ground), 0.05});
+        return std::abs(wheelSpeeds[wheel] - ground) / reference;
+    }
+
+    double speed = 0;        ///< m/s
+    double position = 0;     ///< m
+    double acceleration = 0; ///< m/s^2
+    double yawRate = 0;      ///< rad/s, positive turning right
+    double heading = 0;      ///< rad
+    std::array<double, WheelCount> wheelSpeeds{}; ///< Surface speed, m/s
+    std::array<double, WheelCount> currents{};
+
+private:
+    Settings settings;
+
+    double grip(double slip) const
+    {
+        if (slip < settings.peakSlip)
+        {
+            return settings.peakGrip * slip / settings.peakSlip;
+        }
+        const double fade = std::min(1.0, (slip - settings.peakSlip) / (1 - settings.peakSlip));
+        return settings.peakGrip - (settings.peakGrip - settings.slidingGrip) * fade;
+    }
+};
+
+#endif // DRIVETRAIN_SIM_H
@@ -0,0 +1,165 @@
+#include "vex.h"
+#include "testing.h"
+#include "drivetrainSim.h"
+
+using State = EmergencyBraking::State;
+
+static EmergencyBraking::Inputs approaching(double distance, double speed = 1.0)
+{
+    EmergencyBraking::Inputs inputs;
+    inputs.forwardSpeed = speed;
+    inputs.obstacleDistance = distance;
+    inputs.dtSeconds = 0.01;
+    return inputs;
+}
+
+static State step(EmergencyBraking &braking, const EmergencyBraking::Inputs &inputs, WheelVolts volts = WheelVolts::fromSides(12, 12))
+{
+    return braking.apply(volts, inputs);
+}
+
+TEST(brakingEscalatesWithTimeToImpact)
+{
+    EmergencyBraking braking;
+    CHECK(step(braking, approaching(2.5)) == State::Clear);
+    CHECK(step(braking, approaching(1.9)) == State::Warn);
+    CHECK_NEAR(braking.getTimeToImpact(), 1.9, 1e-9);
+
+    WheelVolts volts = WheelVolts::fromSides(12, -6);
+    CHECK(braking.apply(volts, approaching(1.4)) == State::Limit);
+    CHECK_NEAR(volts.volts[0], 4, 1e-9);
+    CHECK_NEAR(volts.volts[2], -6, 1e-9);
+
+    volts = WheelVolts::fromSides(12, -6);
+    CHECK(braking.apply(volts, approaching(0.9)) == State::Brake);
+    CHECK_NEAR(volts.volts[0], 0, 1e-9);
+    CHECK_NEAR(volts.volts[2], -6, 1e-9); // Backing away is allowed.
+
+    // Escalation skips levels when the obstacle appears late.
+    EmergencyBraking late;
+    CHECK(step(late, approaching(0.5)) == State::Brake);
+}
+
+TEST(brakingIgnoresObstaclesItIsNotClosingOn)
+{
+    EmergencyBraking braking;
+    CHECK(step(braking, approaching(0.3, 0.01)) == State::Clear);
+    CHECK(step(braking, approaching(0.3, -1)) == State::Clear);
+    CHECK(step(braking, approaching(-1)) == State::Clear);
+    CHECK(braking.getTimeToImpact() < 0);
+}
+
+TEST(brakingJumpsToBrakeOnImpact)
+{
+    EmergencyBraking collided;
+    EmergencyBraking::Inputs inputs = approaching(-1);
+    inputs.collision = true;
+    CHECK(step(collided, inputs) == State::Brake);
+
+    EmergencyBraking spike;
+    inputs = approaching(-1);
+    inputs.forwardAccelG = -2;
+    CHECK(step(spike, inputs) == State::Brake);
+
+    // The same deceleration while standing still is not an impact.
+    EmergencyBraking standing;
+    inputs.forwardSpeed = 0;
+    CHECK(step(standing, inputs) == State::Clear);
+
+    reportCollision();
+    CHECK(takeCollision());
+    CHECK(!takeCollision());
+}
+
+TEST(brakingStepsDownOneLevelPerHoldTime)
+{
+    EmergencyBraking braking;
+    CHECK(step(braking, approaching(0.9)) == State::Brake);
+
+    // The obstacle is gone, but each state is kept for minHoldSeconds and released one level at a time.
+    std::vector<std::pair<int, State>> changes;
+    State previous = State::Brake;
+    for (int tick = 1; tick <= 200; ++tick)
+    {
+        const State state = step(braking, approaching(-1));
+        if (state != previous)
+        {
+            changes.emplace_back(tick, state);
+            previous = state;
+        }
+    }
+    CHECK(changes.size() == 3);
+    CHECK(changes[0] == std::make_pair(50, State::Limit));
+    CHECK(changes[1] == std::make_pair(100, State::Warn));
+    CHECK(changes[2] == std::make_pair(150, State::Clear));
+}
+
+TEST(brakingHysteresisStopsChatter)
+{
+    EmergencyBraking braking;
+    CHECK(step(braking, approaching(1.45)) == State::Limit);
+
+    // Time to impact jitters around the Limit threshold for two seconds.
+    int changes = 0;
+    State previous = State::Limit;
+    for (int tick = 0; tick < 200; ++tick)
+    {
+        const State state = step(braking, approaching(tick % 2 ? 1.45 : 1.6));
+        changes += state != previous;
+        previous = state;
+    }
+    CHECK(changes == 0);
+
+    // Clearing the threshold plus the margin steps down once the hold time has passed.
+    CHECK(step(braking, approaching(1.85)) == State::Warn);
+}
+
+TEST(brakingHoldsWhileStoppedAtTheObstacle)
+{
+    EmergencyBraking braking;
+    CHECK(step(braking, approaching(0.5)) == State::Brake);
+    for (int tick = 0; tick < 300; ++tick)
+    {
+        CHECK(step(braking, approaching(0.1, 0)) == State::Brake);
+    }
+    // Backing away releases it.
+    for (int tick = 0; tick < 200; ++tick)
+    {
+        step(braking, approaching(0.4, -0.5));
+    }
+    CHECK(braking.getState() == State::Clear);
+}
+
+TEST(brakingBlocksReverseIntoARearContact)
+{
+    EmergencyBraking braking;
+    EmergencyBraking::Inputs inputs = approaching(-1, -0.5);
+    inputs.rearContact = true;
+    WheelVolts volts = WheelVolts::fromSides(-8, 6);
+    CHECK(braking.apply(volts, inputs) == State::Clear);
+    CHECK_NEAR(volts.volts[0], 0, 1e-9);
+    CHECK_NEAR(volts.volts[2], 6, 1e-9);
+}
+
+TEST(brakingStopsTheSimShortOfAWall)
+{
+    DrivetrainSim sim;
+    EmergencyBraking braking;
+    const double wall = 2.0;
+    const double dt = 0.01;
+    State worst = State::Clear;
+    for (int tick = 0; tick < 400; ++tick)
+    {
+        EmergencyBraking::Inputs inputs;
+        inputs.forwardSpeed = sim.speed;
+        inputs.obstacleDistance = wall - sim.position;
+        inputs.forwardAccelG = sim.acceleration / 9.80665;
+        inputs.dtSeconds = dt;
+        WheelVolts volts = WheelVolts::fromSides(12, 12); // The driver holds full forward throughout.
+        worst = std::max(worst, braking.apply(volts, inputs));
+        sim.step(volts, dt);
+    }
+    CHECK(worst == State::Brake);
+    CHECK(sim.position < wall);
+    CHECK(std::abs(sim.speed) < 0.05);
+}
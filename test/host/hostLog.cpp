@@ -0,0 +1,29 @@
+// Host log sink: records every message instead of writing to the SD card and controllers.
+
+#include "vex.h"
+#include "testing.h"
+
+#include <mutex>
+
+static std::mutex loggedMutex;
+static std::vector<LoggedMessage> logged;
+
+void logHandler(const std::string &functionName, const std::string &message, const Log::Level level, const float &timeOfDisplay)
+{
+    std::lock_guard<std::mutex> lock(loggedMutex);
+    logged.push_back(LoggedMessage{functionName, message, level, timeOfDisplay, std::this_thread::get_id()});
+}
+
+void SD_Card_Logging(const Log::Level &, const std::string &, const std::string &) {}
+
+std::vector<LoggedMessage> loggedMessages()
+{
+    std::lock_guard<std::mutex> lock(loggedMutex);
+    return logged;
+}
+
+void clearLoggedMessages()
+{
+    std::lock_guard<std::mutex> lock(loggedMutex);
+    logged.clear();
+}
@@ -0,0 +1,364 @@
+// Host implementation of the V5 API declared in host/v5_cpp.h.
+
+#include "v5_cpp.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdarg>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+namespace vex
+{
+    const color white(0xFFFFFF), red(0xFF0000), green(0x00FF00), yellow(0xFFFF00), black(0x000000), blue(0x0000FF), orange(0xFFA500), purple(0xFF00FF);
+
+    namespace host
+    {
+        static std::array<MotorState, 21> motors;
+        static std::array<InertialState, 21> inertials;
+        static std::array<ControllerState, 2> controllers;
+        static CompetitionState competitionState;
+        static std::array<bool, 8> threeWireValues{};
+        static double batteryVoltage = 12.6;
+
+        MotorState &motor(int32_t port) { return motors[std::clamp(port, 0, 20)]; }
+        InertialState &inertial(int32_t port) { return inertials[std::clamp(port, 0, 20)]; }
+        ControllerState &controller(controllerType type) { return controllers[type == controllerType::partner ? 1 : 0]; }
+        CompetitionState &competition() { return competitionState; }
+        std::array<bool, 8> &threeWire() { return threeWireValues; }
+        double &batteryVolts() { return batteryVoltage; }
+
+        void resetDevices()
+        {
+            motors.fill(MotorState{});
+            inertials.fill(InertialState{});
+            controllers.fill(ControllerState{});
+            competitionState = CompetitionState{};
+            threeWireValues.fill(false);
+            batteryVoltage = 12.6;
+        }
+    }
+
+    // Threads
+
+    mutex::mutex() : impl(new std::mutex) {}
+    mutex::~mutex() { delete static_cast<std::mutex *>(impl); }
+    void mutex::lock() { static_cast<std::mutex *>(impl)->lock(); }
+    void mutex::unlock() { static_cast<std::mutex *>(impl)->unlock(); }
+    bool mutex::try_lock() { return static_cast<std::mutex *>(impl)->try_lock(); }
+
+    thread::thread() = default;
+    thread::thread(void (*callback)()) : impl(new std::thread(callback)) {}
+    thread::thread(int (*callback)()) : impl(new std::thread([callback]
+                                                             { callback(); })) {}
+    thread::thread(int (*callback)(void *), void *arg) : impl(new std::thread([callback, arg]
+                                                                              { callback(arg); })) {}
+
+    // A vex::thread keeps running when its handle goes out of scope.
+    thread::~thread() { detach(); }
+
+    void thread::join()
+    {
+        if (auto *worker = static_cast<std::thread *>(impl); worker && worker->joinable())
+        {
+            worker->join();
+        }
+    }
+
+    void thread::detach()
+    {
+        if (auto *worker = static_cast<std::thread *>(impl); worker && worker->joinable())
+        {
+            worker->detach();
+        }
+    }
+
+    bool thread::joinable()
+    {
+        auto *worker = static_cast<std::thread *>(impl);
+        return worker && worker->joinable();
+    }
+
+    void thread::interrupt() {}
+    int32_t thread::get_id() { return 0; }
+    void thread::setPriority(int32_t) {}
+    void thread::interruptAll() {}
+
+    void this_thread::sleep_for(uint32_t timeMs) { std::this_thread::sleep_for(std::chrono::milliseconds(timeMs)); }
+    void this_thread::sleep_until(uint32_t timeMs)
+    {
+        if (timeMs > timer::system())
+        {
+            sleep_for(timeMs - timer::system());
+        }
+    }
+    void this_thread::yield() { std::this_thread::yield(); }
+    int32_t this_thread::get_id() { return 0; }
+
+    task::task() = default;
+    task::task(int (*callback)()) : worker(callback) {}
+    task::task(int (*callback)(void *), void *arg) : worker(callback, arg) {}
+    void task::stop() {}
+    void task::stopAll() {}
+
+    // Time
+
+    static const auto programStart = std::chrono::steady_clock::now();
+
+    uint64_t timer::systemHighResolution()
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - programStart).count();
+    }
+    uint32_t timer::system() { return static_cast<uint32_t>(systemHighResolution() / 1000); }
+
+    timer::timer() : startUs(systemHighResolution()) {}
+    uint32_t timer::time() const { return static_cast<uint32_t>((systemHighResolution() - startUs) / 1000); }
+    double timer::time(timeUnits units) const
+    {
+        const double ms = (systemHighResolution() - startUs) / 1000.0;
+        return units == timeUnits::sec ? ms / 1000 : ms;
+    }
+    void timer::clear() { startUs = systemHighResolution(); }
+    void timer::reset() { clear(); }
+
+    // Devices
+
+    triport::triport()
+    {
+        port *const ports[] = {&A, &B, &C, &D, &E, &F, &G, &H};
+        for (int32_t i = 0; i < 8; ++i)
+        {
+            ports[i]->index = i;
+        }
+    }
+    bool triport::port::value() { return host::threeWire()[index]; }
+
+    int32_t device::index() { return portIndex; }
+    bool device::installed() { return host::motor(portIndex).installed && host::inertial(portIndex).installed; }
+
+    motor::motor(int32_t index) : device(index) {}
+    motor::motor(int32_t index, bool reverse) : device(index), reversed(reverse) {}
+    motor::motor(int32_t index, gearSetting, bool reverse) : device(index), reversed(reverse) {}
+    host::MotorState &motor::state() { return host::motor(portIndex); }
+
+    void motor::spin(directionType) { ++state().spinCalls; }
+    void motor::spin(directionType dir, double velocity, velocityUnits) { spin(dir, velocity / 100 * 12, voltageUnits::volt); }
+    void motor::spin(directionType dir, double voltage, voltageUnits units)
+    {
+        const double volts = units == voltageUnits::mV ? voltage / 1000 : voltage;
+        const double sign = (dir == directionType::rev) != reversed ? -1 : 1;
+        state().commandVolts = sign * volts;
+        ++state().spinCalls;
+    }
+    void motor::stop() { stop(state().stopping); }
+    void motor::stop(brakeType mode)
+    {
+        state().commandVolts = 0;
+        state().lastStop = mode;
+        ++state().stopCalls;
+    }
+    void motor::setStopping(brakeType mode) { state().stopping = mode; }
+    void motor::setVelocity(double, velocityUnits) {}
+    void motor::setPosition(double value, rotationUnits) { state().positionDeg = reversed ? -value : value; }
+    void motor::resetPosition() { state().positionDeg = 0; }
+    double motor::velocity(velocityUnits) { return reversed ? -state().velocityRpm : state().velocityRpm; }
+    double motor::position(rotationUnits units)
+    {
+        const double deg = reversed ? -state().positionDeg : state().positionDeg;
+        return units == rotationUnits::rev ? deg / 360 : deg;
+    }
+    double motor::current(currentUnits) { return state().currentAmps; }
+    double motor::temperature(temperatureUnits) { return state().temperatureC; }
+    double motor::voltage(voltageUnits) { return state().commandVolts; }
+    double motor::efficiency(percentUnits) { return 100; }
+    double motor::torque() { return 0; }
+
+    void motor_group::spin(directionType dir, double voltage, voltageUnits units)
+    {
+        for (motor *m : motors)
+        {
+            m->spin(dir, voltage, units);
+        }
+    }
+    void motor_group::spin(directionType dir, double velocity, velocityUnits units)
+    {
+        for (motor *m : motors)
+        {
+            m->spin(dir, velocity, units);
+        }
+    }
+    void motor_group::stop()
+    {
+        for (motor *m : motors)
+        {
+            m->stop();
+        }
+    }
+    void motor_group::stop(brakeType mode)
+    {
+        for (motor *m : motors)
+        {
+            m->stop(mode);
+        }
+    }
+    void motor_group::setStopping(brakeType mode)
+    {
+        for (motor *m : motors)
+        {
+            m->setStopping(mode);
+        }
+    }
+    double motor_group::velocity(velocityUnits units) { return motors.empty() ? 0 : motors.front()->velocity(units); }
+    double motor_group::position(rotationUnits units) { return motors.empty() ? 0 : motors.front()->position(units); }
+    double motor_group::current(currentUnits units)
+    {
+        double total = 0;
+        for (motor *m : motors)
+        {
+            total += m->current(units);
+        }
+        return total;
+    }
+    int32_t motor_group::count() { return static_cast<int32_t>(motors.size()); }
+    void motor_group::resetPosition()
+    {
+        for (motor *m : motors)
+        {
+            m->resetPosition();
+        }
+    }
+
+    inertial::inertial(int32_t index) : device(index) {}
+    host::InertialState &inertial::state() { return host::inertial(portIndex); }
+    void inertial::calibrate() { ++state().calibrateCalls; }
+    bool inertial::isCalibrating() { return state().calibrating; }
+    double inertial::heading(rotationUnits) { return std::fmod(std::fmod(state().rotationDeg, 360) + 360, 360); }
+    double inertial::rotation(rotationUnits) { return state().rotationDeg; }
+    double inertial::pitch(rotationUnits) { return state().pitchDeg; }
+    double inertial::roll(rotationUnits) { return state().rollDeg; }
+    double inertial::yaw(rotationUnits) { return std::remainder(state().rotationDeg, 360); }
+    double inertial::gyroRate(axisType axis, velocityUnits) { return state().gyroRateDps[static_cast<std::size_t>(axis)]; }
+    double inertial::acceleration(axisType axis) { return state().accelerationG[static_cast<std::size_t>(axis)]; }
+    void inertial::collision(void (*)(axisType, double, double, double)) {}
+    void inertial::resetRotation() { state().rotationDeg = 0; }
+    void inertial::setHeading(double value, rotationUnits) { state().rotationDeg = value; }
+
+    smartdrive::smartdrive(motor_group &, motor_group &, inertial &, double, double, double, distanceUnits, double) {}
+    void smartdrive::setStopping(brakeType) {}
+    void smartdrive::stop() {}
+
+    bumper::bumper(triport::port &port) : port(&port) {}
+    bool bumper::pressing() { return port->value(); }
+    void bumper::pressed(void (*)()) {}
+
+    distance::distance(int32_t index) : device(index) {}
+    double distance::objectDistance(distanceUnits) { return 9999; }
+    double distance::objectVelocity() { return 0; }
+    bool distance::isObjectDetected() { return false; }
+
+    controller::controller() : controller(controllerType::primary) {}
+    controller::controller(controllerType type) : type(type)
+    {
+        axis *const axes[] = {&Axis1, &Axis2, &Axis3, &Axis4};
+        for (int32_t i = 0; i < 4; ++i)
+        {
+            axes[i]->owner = type;
+            axes[i]->id = i;
+        }
+        button *const buttons[] = {&ButtonA, &ButtonB, &ButtonX, &ButtonY, &ButtonUp, &ButtonDown, &ButtonLeft, &ButtonRight, &ButtonL1, &ButtonL2, &ButtonR1, &ButtonR2};
+        for (int32_t i = 0; i < 12; ++i)
+        {
+            buttons[i]->owner = type;
+            buttons[i]->id = i;
+        }
+    }
+    int32_t controller::axis::position(percentUnits) const { return host::controller(owner).axes[id]; }
+    void controller::axis::changed(void (*)()) {}
+    bool controller::button::pressing() const { return host::controller(owner).buttons[id]; }
+    void controller::button::pressed(void (*)()) {}
+    void controller::button::released(void (*)()) {}
+    void controller::lcd::print(const char *, ...) {}
+    void controller::lcd::clearScreen() {}
+    void controller::lcd::clearLine(int32_t) {}
+    void controller::lcd::setCursor(int32_t, int32_t) {}
+    void controller::lcd::newLine() {}
+    bool controller::installed() { return host::controller(type).installed; }
+    void controller::rumble(const char *pattern) { host::controller(type).lastRumble = pattern; }
+
+    void brain::lcd::print(const char *, ...) {}
+    void brain::lcd::printAt(int32_t, int32_t, const char *, ...) {}
+    void brain::lcd::printAt(int32_t, int32_t, bool, const char *, ...) {}
+    void brain::lcd::clearScreen() {}
+    void brain::lcd::clearScreen(const color &) {}
+    void brain::lcd::clearLine(int32_t) {}
+    void brain::lcd::newLine() {}
+    void brain::lcd::setCursor(int32_t, int32_t) {}
+    void brain::lcd::setFont(fontType) {}
+    void brain::lcd::setFillColor(const color &) {}
+    void brain::lcd::setPenColor(const color &) {}
+    void brain::lcd::drawRectangle(int32_t, int32_t, int32_t, int32_t) {}
+    void brain::lcd::drawLine(int32_t, int32_t, int32_t, int32_t) {}
+    void brain::lcd::drawImageFromBuffer(uint32_t *, int32_t, int32_t, int32_t, int32_t) {}
+    bool brain::lcd::render() { return true; }
+    bool brain::lcd::pressing() { return false; }
+    int32_t brain::lcd::xPosition() { return 0; }
+    int32_t brain::lcd::yPosition() { return 0; }
+
+    // The SD card is the working directory the tests run in.
+    bool brain::sdcard::isInserted() { return true; }
+    bool brain::sdcard::exists(const char *name) { return std::filesystem::exists(name); }
+    int32_t brain::sdcard::size(const char *name)
+    {
+        std::error_code error;
+        const auto bytes = std::filesystem::file_size(name, error);
+        return error ? 0 : static_cast<int32_t>(bytes);
+    }
+    int32_t brain::sdcard::loadfile(const char *name, uint8_t *buffer, int32_t length)
+    {
+        std::ifstream file(name, std::ios::binary);
+        file.read(reinterpret_cast<char *>(buffer), length);
+        return static_cast<int32_t>(file.gcount());
+    }
+    int32_t brain::sdcard::savefile(const char *name, uint8_t *buffer, int32_t length)
+    {
+        std::ofstream file(name, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char *>(buffer), length);
+        return file ? length : 0;
+    }
+    int32_t brain::sdcard::appendfile(const char *name, uint8_t *buffer, int32_t length)
+    {
+        std::ofstream file(name, std::ios::binary | std::ios::app);
+        file.write(reinterpret_cast<const char *>(buffer), length);
+        return file ? length : 0;
+    }
+    uint32_t brain::sdcard::timestamp(const char *) { return 0; }
+
+    uint32_t brain::battery::capacity(percentUnits) { return 100; }
+    double brain::battery::voltage(voltageUnits) { return host::batteryVolts(); }
+    double brain::battery::current(currentUnits) { return 0; }
+
+    void competition::autonomous(void (*)()) {}
+    void competition::drivercontrol(void (*)()) {}
+    bool competition::isEnabled() { return host::competition().enabled; }
+    bool competition::isAutonomous() { return host::competition().autonomous; }
+    bool competition::isDriverControl() { return host::competition().driverControl; }
+    bool competition::isCompetitionSwitch() { return host::competition().competitionSwitch; }
+    bool competition::isFieldControl() { return host::competition().fieldControl; }
+    bool competition::bStopAllTasksBetweenModes = false;
+}
+
+extern "C"
+{
+    int32_t vexMotorVelocityGet(uint32_t index)
+    {
+        return static_cast<int32_t>(vex::host::motor(static_cast<int32_t>(index)).velocityRpm);
+    }
+
+    void vexSystemExitRequest()
+    {
+        std::fprintf(stderr, "vexSystemExitRequest called\n");
+        std::abort();
+    }
+}
@@ -0,0 +1,435 @@
+#ifndef HOST_V5_CPP_H
+#define HOST_V5_CPP_H
+
+// Host stand-in for the VEX SDK's v5_cpp.h, used only by the unit tests in test/.
+//
+// Declares the part of the V5 API this project uses. Devices are backed by plain state in
+// vex::host that a test sets up and inspects, the clock is the host's steady clock and threads
+// are std::threads. Screens, the controller LCD and rumble do nothing.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <format>
+#include <functional>
+#include <map>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+extern "C"
+{
+    int32_t vexMotorVelocityGet(uint32_t index);
+    void vexSystemExitRequest();
+}
+
+namespace vex
+{
+    enum class velocityUnits { pct, rpm, dps };
+    enum class voltageUnits { volt, mV };
+    enum class rotationUnits { deg, rev, raw };
+    enum class temperatureUnits { celsius, fahrenheit };
+    enum class timeUnits { sec, msec };
+    enum class currentUnits { amp };
+    enum class percentUnits { pct };
+    enum class distanceUnits { mm, in, cm };
+    enum class directionType { fwd, rev, undefined };
+    enum class brakeType { coast, brake, hold, undefined };
+    enum class gearSetting { ratio36_1, ratio18_1, ratio6_1 };
+    enum class axisType { xaxis, yaxis, zaxis };
+    enum class controllerType { primary, partner };
+    enum class fontType { mono12, mono15, mono20, prop20, prop40 };
+
+    constexpr fontType mono12 = fontType::mono12, mono15 = fontType::mono15, mono20 = fontType::mono20;
+    constexpr fontType prop20 = fontType::prop20, prop40 = fontType::prop40;
+    constexpr velocityUnits rpm = velocityUnits::rpm, dps = velocityUnits::dps;
+    constexpr voltageUnits volt = voltageUnits::volt;
+    constexpr rotationUnits degrees = rotationUnits::deg, deg = rotationUnits::deg;
+    constexpr timeUnits seconds = timeUnits::sec, msec = timeUnits::msec;
+    constexpr int32_t PORT1 = 0, PORT2 = 1, PORT3 = 2, PORT4 = 3, PORT5 = 4, PORT6 = 5, PORT7 = 6, PORT8 = 7, PORT9 = 8, PORT10 = 9;
+    constexpr int32_t PORT11 = 10, PORT12 = 11, PORT13 = 12, PORT14 = 13, PORT15 = 14, PORT16 = 15, PORT17 = 16, PORT18 = 17, PORT19 = 18, PORT20 = 19, PORT21 = 20;
+
+    class color
+    {
+    public:
+        color() = default;
+        color(uint32_t rgb) : rgb(rgb) {}
+        uint32_t rgb = 0;
+    };
+    extern const color white, red, green, yellow, black, blue, orange, purple;
+
+    namespace host
+    {
+        /// @brief Simulated smart motor, one per port.
+        struct MotorState
+        {
+            bool installed = true;
+            double velocityRpm = 0;
+            double positionDeg = 0;
+            double currentAmps = 0;
+            double temperatureC = 30;
+            double commandVolts = 0;            ///< Last spin() voltage, 0 after stop().
+            brakeType stopping = brakeType::coast;
+            brakeType lastStop = brakeType::undefined; ///< Mode of the last stop() call.
+            uint32_t spinCalls = 0;
+            uint32_t stopCalls = 0;
+        };
+
+        /// @brief Simulated inertial sensor, one per port.
+        struct InertialState
+        {
+            bool installed = true;
+            bool calibrating = false;
+            double rotationDeg = 0;
+            double pitchDeg = 0;
+            double rollDeg = 0;
+            std::array<double, 3> gyroRateDps{};
+            std::array<double, 3> accelerationG{};
+            uint32_t calibrateCalls = 0;
+        };
+
+        /// @brief Simulated controller. Axes are in percent, buttons are ordered A, B, X, Y, Up, Down, Left, Right, L1, L2, R1, R2.
+        struct ControllerState
+        {
+            bool installed = true;
+            std::array<int32_t, 4> axes{};
+            std::array<bool, 12> buttons{};
+            std::string lastRumble;
+        };
+
+        /// @brief Field or competition switch state seen by vex::competition.
+        struct CompetitionState
+        {
+            bool enabled = true;
+            bool autonomous = false;
+            bool driverControl = true;
+            bool competitionSwitch = false;
+            bool fieldControl = false;
+        };
+
+        MotorState &motor(int32_t port);
+        InertialState &inertial(int32_t port);
+        ControllerState &controller(controllerType type);
+        CompetitionState &competition();
+        std::array<bool, 8> &threeWire();
+        double &batteryVolts();
+
+        /// @brief Puts every simulated device back to its default state.
+        void resetDevices();
+    }
+
+    class mutex
+    {
+    public:
+        mutex();
+        ~mutex();
+        mutex(const mutex &) = delete;
+        mutex &operator=(const mutex &) = delete;
+        void lock();
+        void unlock();
+        bool try_lock();
+
+    private:
+        void *impl;
+    };
+
+    class thread
+    {
+    public:
+        thread();
+        thread(void (*callback)());
+        thread(int (*callback)());
+        thread(int (*callback)(void *), void *arg);
+        ~thread();
+        void join();
+        void interrupt();
+        void detach();
+        bool joinable();
+        int32_t get_id();
+        void setPriority(int32_t priority);
+        static void interruptAll();
+        static const int32_t threadPriorityLow = 1;
+        static const int32_t threadPriorityNormal = 7;
+        static const int32_t threadPriorityHigh = 16;
+
+    private:
+        void *impl = nullptr;
+    };
+
+    namespace this_thread
+    {
+        void sleep_for(uint32_t timeMs);
+        void sleep_until(uint32_t timeMs);
+        void yield();
+        int32_t get_id();
+    }
+
+    class task
+    {
+    public:
+        task();
+        task(int (*callback)());
+        task(int (*callback)(void *), void *arg);
+        void stop();
+        static void stopAll();
+
+    private:
+        thread worker;
+    };
+
+    class timer
+    {
+    public:
+        timer();
+        uint32_t time() const;
+        double time(timeUnits units) const;
+        void clear();
+        void reset();
+        static uint32_t system();
+        static uint64_t systemHighResolution();
+
+    private:
+        uint64_t startUs;
+    };
+
+    class triport
+    {
+    public:
+        class port
+        {
+        public:
+            bool value();
+            int32_t index = 0;
+        };
+        triport();
+        port A, B, C, D, E, F, G, H;
+    };
+
+    class device
+    {
+    public:
+        device() = default;
+        explicit device(int32_t index) : portIndex(index) {}
+        int32_t index();
+        bool installed();
+
+    protected:
+        int32_t portIndex = 0;
+    };
+
+    class motor : public device
+    {
+    public:
+        motor(int32_t index);
+        motor(int32_t index, bool reverse);
+        motor(int32_t index, gearSetting gears, bool reverse);
+        void spin(directionType dir);
+        void spin(directionType dir, double velocity, velocityUnits units);
+        void spin(directionType dir, double voltage, voltageUnits units);
+        void stop();
+        void stop(brakeType mode);
+        void setStopping(brakeType mode);
+        void setVelocity(double velocity, velocityUnits units);
+        void setPosition(double value, rotationUnits units);
+        void resetPosition();
+        double velocity(velocityUnits units);
+        double position(rotationUnits units);
+        double current(currentUnits units = currentUnits::amp);
+        double temperature(temperatureUnits units);
+        double voltage(voltageUnits units = voltageUnits::volt);
+        double efficiency(percentUnits units = percentUnits::pct);
+        double torque();
+
+    private:
+        host::MotorState &state();
+        bool reversed = false;
+    };
+
+    class motor_group
+    {
+    public:
+        motor_group() = default;
+        template <class... Motors>
+        motor_group(Motors &...motors) : motors{&motors...} {}
+        void spin(directionType dir, double voltage, voltageUnits units);
+        void spin(directionType dir, double velocity, velocityUnits units);
+        void stop();
+        void stop(brakeType mode);
+        void setStopping(brakeType mode);
+        double velocity(velocityUnits units);
+        double position(rotationUnits units);
+        double current(currentUnits units = currentUnits::amp);
+        int32_t count();
+        void resetPosition();
+
+    private:
+        std::vector<motor *> motors;
+    };
+
+    class inertial : public device
+    {
+    public:
+        inertial(int32_t index);
+        void calibrate();
+        bool isCalibrating();
+        double heading(rotationUnits units = rotationUnits::deg);
+        double rotation(rotationUnits units = rotationUnits::deg);
+        double pitch(rotationUnits units = rotationUnits::deg);
+        double roll(rotationUnits units = rotationUnits::deg);
+        double yaw(rotationUnits units = rotationUnits::deg);
+        double gyroRate(axisType axis, velocityUnits units);
+        double acceleration(axisType axis);
+        void collision(void (*callback)(axisType, double, double, double));
+        void resetRotation();
+        void setHeading(double value, rotationUnits units);
+
+    private:
+        host::InertialState &state();
+    };
+
+    class smartdrive
+    {
+    public:
+        smartdrive(motor_group &left, motor_group &right, inertial &gyro, double wheelTravel, double trackWidth, double wheelBase, distanceUnits units, double externalGearRatio);
+        void setStopping(brakeType mode);
+        void stop();
+    };
+
+    class bumper
+    {
+    public:
+        bumper(triport::port &port);
+        bool pressing();
+        void pressed(void (*callback)());
+
+    private:
+        triport::port *port;
+    };
+
+    class distance : public device
+    {
+    public:
+        distance(int32_t index);
+        double objectDistance(distanceUnits units);
+        double objectVelocity();
+        bool isObjectDetected();
+    };
+
+    class controller
+    {
+    public:
+        controller();
+        controller(controllerType type);
+
+        class axis
+        {
+        public:
+            int32_t position(percentUnits units = percentUnits::pct) const;
+            void changed(void (*callback)());
+            controllerType owner = controllerType::primary;
+            int32_t id = 0;
+        };
+
+        class button
+        {
+        public:
+            bool pressing() const;
+            void pressed(void (*callback)());
+            void released(void (*callback)());
+            controllerType owner = controllerType::primary;
+            int32_t id = 0;
+        };
+
+        class lcd
+        {
+        public:
+            void print(const char *format, ...);
+            void clearScreen();
+            void clearLine(int32_t row);
+            void setCursor(int32_t row, int32_t col);
+            void newLine();
+        };
+
+        axis Axis1, Axis2, Axis3, Axis4;
+        button ButtonA, ButtonB, ButtonX, ButtonY, ButtonUp, ButtonDown, ButtonLeft, ButtonRight, ButtonL1, ButtonL2, ButtonR1, ButtonR2;
+        lcd Screen;
+        bool installed();
+        void rumble(const char *pattern);
+
+    private:
+        controllerType type;
+    };
+
+    class brain
+    {
+    public:
+        class lcd
+        {
+        public:
+            void print(const char *format, ...);
+            void printAt(int32_t x, int32_t y, const char *format, ...);
+            void printAt(int32_t x, int32_t y, bool opaque, const char *format, ...);
+            void clearScreen();
+            void clearScreen(const color &fill);
+            void clearLine(int32_t row);
+            void newLine();
+            void setCursor(int32_t row, int32_t col);
+            void setFont(fontType font);
+            void setFillColor(const color &fill);
+            void setPenColor(const color &pen);
+            void drawRectangle(int32_t x, int32_t y, int32_t width, int32_t height);
+            void drawLine(int32_t x1, int32_t y1, int32_t x2, int32_t y2);
+            void drawImageFromBuffer(uint32_t *buffer, int32_t x, int32_t y, int32_t width, int32_t height);
+            bool render();
+            bool pressing();
+            int32_t xPosition();
+            int32_t yPosition();
+        };
+
+        class sdcard
+        {
+        public:
+            bool isInserted();
+            bool exists(const char *name);
+            int32_t size(const char *name);
+            int32_t loadfile(const char *name, uint8_t *buffer, int32_t length);
+            int32_t savefile(const char *name, uint8_t *buffer, int32_t length);
+            int32_t appendfile(const char *name, uint8_t *buffer, int32_t length);
+            uint32_t timestamp(const char *name);
+        };
+
+        class battery
+        {
+        public:
+            uint32_t capacity(percentUnits units = percentUnits::pct);
+            double voltage(voltageUnits units = voltageUnits::volt);
+            double current(currentUnits units = currentUnits::amp);
+        };
+
+        lcd Screen;
+        timer Timer;
+        sdcard SDcard;
+        battery Battery;
+        triport ThreeWirePort;
+    };
+
+    class competition
+    {
+    public:
+        void autonomous(void (*callback)());
+        void drivercontrol(void (*callback)());
+        bool isEnabled();
+        bool isAutonomous();
+        bool isDriverControl();
+        bool isCompetitionSwitch();
+        bool isFieldControl();
+        static bool bStopAllTasksBetweenModes;
+    };
+}
+
+#endif // HOST_V5_CPP_H
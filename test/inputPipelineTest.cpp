@@ -0,0 +1,207 @@
+#include "vex.h"
+#include "testing.h"
+#include <chrono>
+#include <cstdio>
+
+using DriveMode = configManager::DriveMode;
+
+static StickSample sticks(int axis1, int axis2, int axis3, int axis4)
+{
+    return StickSample{{axis1, axis2, axis3, axis4}};
+}
+
+TEST(inputStagesShapeThePercent)
+{
+    CHECK(Deadzone{10}(9) == 0);
+    CHECK(Deadzone{10}(-9) == 0);
+    CHECK(Deadzone{10}(10) == 10);
+    CHECK_NEAR(ExpoCurve{0}(50), 50, 1e-9);
+    CHECK_NEAR(ExpoCurve{1}(50), 12.5, 1e-9);
+    CHECK_NEAR(ExpoCurve{0.5}(100), 100, 1e-9);
+    CHECK_NEAR(VoltageScale{12}(-100), -12, 1e-9);
+
+    StageChain<Deadzone, ExpoCurve, VoltageScale> chain{{Deadzone{5}, ExpoCurve{0}, VoltageScale{12}}};
+    CHECK(chain(4) == 0);
+    CHECK_NEAR(chain(50), 6, 1e-9);
+}
+
+TEST(curveTableMatchesChainAndClamps)
+{
+    StageChain<Deadzone, ExpoCurve, VoltageScale> chain{{Deadzone{8}, ExpoCurve{0.3}, VoltageScale{12}}};
+    AxisCurveTable table;
+    table.build(chain);
+    for (int position = -100; position <= 100; ++position)
+    {
+        CHECK_NEAR(table.lookup(position), chain(position), 1e-12);
+    }
+    CHECK_NEAR(table.lookup(127), chain(100), 1e-12);
+    CHECK_NEAR(table.lookup(-128), chain(-100), 1e-12);
+}
+
+TEST(slewLimiterCapsStepsPerTick)
+{
+    SlewRateLimiter slew;
+    slew.setRate(100);
+    CHECK_NEAR(slew(12, 0.01), 1, 1e-9);
+    CHECK_NEAR(slew(12, 0.01), 2, 1e-9);
+    CHECK_NEAR(slew(-12, 0.01), 1, 1e-9);
+    slew.setRate(0);
+    CHECK_NEAR(slew(-12, 0.01), -12, 1e-9);
+}
+
+TEST(driveModesReadTheirOwnAxes)
+{
+    InputPipeline::Settings settings;
+    settings.leftDeadzone = 0;
+    settings.rightDeadzone = 0;
+    InputPipeline pipeline;
+    const StickSample sample = sticks(10, 20, 30, 40);
+
+    pipeline.configure(DriveMode::LeftArcade, settings);
+    DriveCommand command = pipeline.process(sample, 0.01);
+    CHECK_NEAR(command.forwardVolts, 3.6, 1e-9); // Axis3
+    CHECK_NEAR(command.turnVolts, 4.8, 1e-9);    // Axis4
+
+    pipeline.configure(DriveMode::RightArcade, settings);
+    command = pipeline.process(sample, 0.01);
+    CHECK_NEAR(command.forwardVolts, 2.4, 1e-9); // Axis2
+    CHECK_NEAR(command.turnVolts, 1.2, 1e-9);    // Axis1
+
+    pipeline.configure(DriveMode::SplitArcade, settings);
+    command = pipeline.process(sample, 0.01);
+    CHECK_NEAR(command.forwardVolts, 3.6, 1e-9); // Axis3
+    CHECK_NEAR(command.turnVolts, 1.2, 1e-9);    // Axis1
+
+    // Tank: Axis3 is the left side and Axis2 the right side.
+    pipeline.configure(DriveMode::Tank, settings);
+    command = pipeline.process(sample, 0.01);
+    CHECK_NEAR(command.leftVolts(), 3.6, 1e-9);
+    CHECK_NEAR(command.rightVolts(), 2.4, 1e-9);
+    CHECK(pipeline.getDriveMode() == DriveMode::Tank);
+}
+
+TEST(deadzonesApplyPerStick)
+{
+    InputPipeline::Settings settings;
+    settings.leftDeadzone = 15;
+    settings.rightDeadzone = 5;
+    InputPipeline pipeline;
+    pipeline.configure(DriveMode::SplitArcade, settings);
+
+    const DriveCommand command = pipeline.process(sticks(8, 0, 12, 0), 0.01);
+    CHECK(command.forwardVolts == 0);
+    CHECK_NEAR(command.turnVolts, 0.96, 1e-9);
+}
+
+TEST(reconfiguringMidRampKeepsSlew)
+{
+    InputPipeline::Settings settings;
+    settings.slewVoltsPerSecond = 50;
+    InputPipeline pipeline;
+    pipeline.configure(DriveMode::SplitArcade, settings);
+    CHECK_NEAR(pipeline.process(sticks(0, 0, 100, 0), 0.02).forwardVolts, 1, 1e-9);
+    CHECK_NEAR(pipeline.process(sticks(0, 0, 100, 0), 0.02).forwardVolts, 2, 1e-9);
+
+    // A live reload, then a mode change: both carry on from 2 V.
+    settings.expo = 0.5;
+    pipeline.configure(DriveMode::SplitArcade, settings);
+    CHECK_NEAR(pipeline.process(sticks(0, 0, 100, 0), 0.02).forwardVolts, 3, 1e-9);
+    pipeline.configure(DriveMode::LeftArcade, settings);
+    CHECK_NEAR(pipeline.process(sticks(0, 0, 100, 0), 0.02).forwardVolts, 4, 1e-9);
+
+    pipeline.reset();
+    CHECK_NEAR(pipeline.process(sticks(0, 0, 100, 0), 0.02).forwardVolts, 1, 1e-9);
+}
+
+/**
+ * The per-mode switch userControl used before the pipeline, kept here as the benchmark's
+ * reference: axis selection, * 0.12 and the deadzones, reading each axis twice.
+ */
+static DriveCommand switchPath(DriveMode mode, const StickSample &sample, int leftDeadzone, int rightDeadzone)
+{
+    const std::array<int, 4> &axes = sample.axes;
+    double forwardVolts = 0;
+    double turnVolts = 0;
+    switch (mode)
+    {
+    case DriveMode::LeftArcade:
+        turnVolts = std::abs(axes[3]) < rightDeadzone ? 0 : axes[3] * 0.12;
+        forwardVolts = std::abs(axes[2]) < leftDeadzone ? 0 : axes[2] * 0.12;
+        break;
+    case DriveMode::RightArcade:
+        turnVolts = std::abs(axes[0]) < rightDeadzone ? 0 : axes[0] * 0.12;
+        forwardVolts = std::abs(axes[1]) < leftDeadzone ? 0 : axes[1] * 0.12;
+        break;
+    case DriveMode::SplitArcade:
+        turnVolts = std::abs(axes[0]) < rightDeadzone ? 0 : axes[0] * 0.12;
+        forwardVolts = std::abs(axes[2]) < leftDeadzone ? 0 : axes[2] * 0.12;
+        break;
+    case DriveMode::Tank:
+    {
+        const double leftVolts = std::abs(axes[2]) < leftDeadzone ? 0 : axes[2] * 0.12;
+        const double rightVolts = std::abs(axes[1]) < rightDeadzone ? 0 : axes[1] * 0.12;
+        forwardVolts = (leftVolts + rightVolts) / 2;
+        turnVolts = (leftVolts - rightVolts) / 2;
+        break;
+    }
+    }
+    return DriveCommand{forwardVolts, turnVolts};
+}
+
+TEST(inputPipelineBenchmarkAgainstSwitch)
+{
+    // Sweep every stick so neither path sees one value over and over.
+    std::vector<StickSample> samples;
+    for (int position = -100; position <= 100; ++position)
+    {
+        samples.push_back(sticks(position, -position, position / 2, 100 - std::abs(position)));
+    }
+    InputPipeline::Settings settings;
+    settings.slewVoltsPerSecond = 300;
+    InputPipeline pipeline;
+    pipeline.configure(DriveMode::SplitArcade, settings);
+
+    constexpr int ticks = 2000000;
+    volatile double sink = 0;
+    const auto bestNsPerTick = [&](auto &&tick)
+    {
+        double best = 1e9;
+        for (int run = 0; run < 5; ++run)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < ticks; ++i)
+            {
+                sink = sink + tick(samples[i % samples.size()]).leftVolts();
+            }
+            best = std::min(best, std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / ticks);
+        }
+        return best;
+    };
+    const double pipelineNs = bestNsPerTick([&](const StickSample &sample)
+                                            { return pipeline.process(sample, 0.01); });
+    const double switchNs = bestNsPerTick([&](const StickSample &sample)
+                                          { return switchPath(DriveMode::SplitArcade, sample, settings.leftDeadzone, settings.rightDeadzone); });
+    std::printf("  InputPipeline::process %.1f ns per tick, old switch %.1f ns per tick\n", pipelineNs, switchNs);
+    // Loose bound so a slow host does not fail the suite; the printed figures are the benchmark.
+    CHECK(pipelineNs < 1000);
+
+    // Without expo or slew both paths give the same command.
+    settings.slewVoltsPerSecond = 0;
+    for (DriveMode mode : {DriveMode::LeftArcade, DriveMode::RightArcade, DriveMode::SplitArcade, DriveMode::Tank})
+    {
+        pipeline.configure(mode, settings);
+        for (const StickSample &sample : samples)
+        {
+            const DriveCommand expected = switchPath(mode, sample, settings.leftDeadzone, settings.rightDeadzone);
+            const DriveCommand command = pipeline.process(sample, 0.01);
+            CHECK_NEAR(command.leftVolts(), expected.leftVolts(), 1e-9);
+            CHECK_NEAR(command.rightVolts(), expected.rightVolts(), 1e-9);
+        }
+    }
+}
+
+TEST(readSticksReadsEachAxisOnce)
+{
+    vex::host::controller(vex::controllerType::primary).axes = {-100, 25, 50, 100};
+    CHECK(readSticks(primaryController).axes == (std::array<int, 4>{-100, 25, 50, 100}));
+}
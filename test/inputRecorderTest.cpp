@@ -0,0 +1,164 @@
+#include "vex.h"
+#include "testing.h"
+#include <fstream>
+
+using DriveMode = configManager::DriveMode;
+
+// A scripted driver: stick sweeps, a held button and a drive mode change part way through.
+static void driveScript(int tick, vex::host::ControllerState &controller, DriveMode &mode)
+{
+    controller.axes[2] = tick < 100 ? tick : (tick < 200 ? 100 : 0);           // Axis3 forward
+    controller.axes[0] = static_cast<int>(60 * std::sin(tick * 0.05));          // Axis1 turn
+    controller.axes[1] = tick >= 250 ? -80 : 0;                                  // Axis2, tank right side
+    controller.buttons[static_cast<std::size_t>(ControllerButton::R1)] = tick >= 50 && tick < 60;
+    mode = tick < 250 ? DriveMode::SplitArcade : DriveMode::Tank;
+}
+
+TEST(recorderRoundTripsEverySample)
+{
+    InputRecorder recorder(10, DriveMode::SplitArcade);
+    std::vector<ControllerSample> recorded;
+    std::vector<DriveMode> modes;
+    for (int tick = 0; tick < 300; ++tick)
+    {
+        driveScript(tick, vex::host::controller(vex::controllerType::primary), modes.emplace_back());
+        ControllerSample sample{readSticks(primaryController), readButtons(primaryController)};
+        CHECK(recorder.record(sample, modes.back()));
+        recorded.push_back(sample);
+    }
+    CHECK(recorder.save("replay.bin"));
+
+    InputReplayer replayer;
+    CHECK(replayer.load("replay.bin"));
+    CHECK(replayer.getTickMs() == 10);
+    CHECK(replayer.getDriveMode() == DriveMode::SplitArcade);
+    CHECK(replayer.getSampleCount() == 300);
+    ControllerSample sample;
+    DriveMode mode;
+    for (std::size_t tick = 0; tick < recorded.size(); ++tick)
+    {
+        CHECK(replayer.next(sample, mode));
+        CHECK(sample.sticks.axes == recorded[tick].sticks.axes);
+        CHECK(sample.buttons == recorded[tick].buttons);
+        CHECK(mode == modes[tick]);
+    }
+    CHECK(!replayer.next(sample, mode));
+}
+
+TEST(recorderSpendsOneByteOnAnIdleTick)
+{
+    InputRecorder recorder(10, DriveMode::SplitArcade);
+    ControllerSample sample;
+    sample.sticks.axes = {10, -20, 30, -40};
+    recorder.record(sample, DriveMode::SplitArcade);
+    for (int tick = 0; tick < 99; ++tick)
+    {
+        recorder.record(sample, DriveMode::SplitArcade);
+    }
+    CHECK(recorder.save("idle.bin"));
+    std::ifstream file("idle.bin", std::ios::binary | std::ios::ate);
+    // 20-byte header, a full first record (mask, 4 axes, 2 button bytes), then 99 one-byte ticks.
+    CHECK(file.tellg() == 20 + 7 + 99);
+}
+
+TEST(recorderStopsWhenFull)
+{
+    InputRecorder recorder(10, DriveMode::SplitArcade, 3);
+    ControllerSample sample;
+    CHECK(recorder.record(sample, DriveMode::SplitArcade));
+    CHECK(recorder.record(sample, DriveMode::SplitArcade));
+    CHECK(recorder.record(sample, DriveMode::SplitArcade));
+    CHECK(!recorder.record(sample, DriveMode::SplitArcade));
+    CHECK(recorder.getSampleCount() == 3);
+}
+
+TEST(replayerRejectsBadFiles)
+{
+    InputReplayer replayer;
+    CHECK(!replayer.load("missing.bin"));
+
+    std::ofstream("garbage.bin", std::ios::binary) << "not a replay file at all";
+    CHECK(!replayer.load("garbage.bin"));
+
+    // A valid header whose records were cut short ends the replay instead of reading past the end.
+    InputRecorder recorder(10, DriveMode::SplitArcade);
+    ControllerSample sample;
+    sample.sticks.axes = {1, 2, 3, 4};
+    recorder.record(sample, DriveMode::SplitArcade);
+    recorder.record(sample, DriveMode::SplitArcade);
+    recorder.save("short.bin");
+    std::ifstream in("short.bin", std::ios::binary);
+    std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    std::ofstream("short.bin", std::ios::binary | std::ios::trunc) << bytes.substr(0, bytes.size() - 4);
+    CHECK(replayer.load("short.bin"));
+    DriveMode mode;
+    CHECK(!replayer.next(sample, mode));
+}
+
+// Runs the drive pipeline from the stubbed controller and returns the wheel voltages of every tick.
+static std::vector<WheelVolts> driveLive(InputRecorder &recorder)
+{
+    DriveSystem drive(10);
+    drive.configure(DriveMode::SplitArcade);
+    std::vector<WheelVolts> outputs;
+    for (int tick = 0; tick < 300; ++tick)
+    {
+        DriveMode mode;
+        driveScript(tick, vex::host::controller(vex::controllerType::primary), mode);
+        if (mode != drive.getDriveMode())
+        {
+            drive.configure(mode);
+        }
+        const SensorFrame frame = readSensorFrame(primaryController);
+        recorder.record(ControllerSample{frame.sticks, frame.buttons}, mode);
+        outputs.push_back(drive.compute(frame));
+    }
+    return outputs;
+}
+
+// The same loop as replayRecording(): live sensors, recorded driver input.
+static std::vector<WheelVolts> driveReplay(const std::string &fileName)
+{
+    InputReplayer replayer;
+    CHECK(replayer.load(fileName));
+    DriveSystem drive(replayer.getTickMs());
+    drive.configure(replayer.getDriveMode());
+    vex::host::controller(vex::controllerType::primary) = {};
+    std::vector<WheelVolts> outputs;
+    ControllerSample sample;
+    DriveMode mode;
+    while (replayer.next(sample, mode))
+    {
+        if (mode != drive.getDriveMode())
+        {
+            drive.configure(mode);
+        }
+        SensorFrame frame = readSensorFrame(primaryController);
+        frame.sticks = sample.sticks;
+        frame.buttons = sample.buttons;
+        outputs.push_back(drive.compute(frame));
+    }
+    return outputs;
+}
+
+TEST(replayReproducesTheLiveDriveCommands)
+{
+    Devices.begin();
+    InputRecorder recorder(10, DriveMode::SplitArcade);
+    const std::vector<WheelVolts> live = driveLive(recorder);
+    CHECK(recorder.save("drive.bin"));
+
+    const std::vector<WheelVolts> first = driveReplay("drive.bin");
+    const std::vector<WheelVolts> second = driveReplay("drive.bin");
+    CHECK(first.size() == live.size());
+    CHECK(second.size() == live.size());
+    bool identical = first.size() == live.size() && second.size() == live.size();
+    bool moved = false;
+    for (std::size_t tick = 0; identical && tick < live.size(); ++tick)
+    {
+        identical = live[tick].volts == first[tick].volts && first[tick].volts == second[tick].volts;
+        moved = moved || live[tick].volts[0] != 0;
+    }
+    CHECK(identical);
+    CHECK(moved);
+}
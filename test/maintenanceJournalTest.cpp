@@ -0,0 +1,136 @@
+#include "vex.h"
+#include "testing.h"
+#include <filesystem>
+#include <fstream>
+
+static const char *journalFiles[2] = {"journal_a.jnl", "journal_b.jnl"};
+constexpr std::uintmax_t journalRecordSize = 24;
+
+static void removeJournal()
+{
+    std::filesystem::remove(journalFiles[0]);
+    std::filesystem::remove(journalFiles[1]);
+}
+
+static MaintenanceJournal::State stateAt(std::int32_t odometer)
+{
+    return MaintenanceJournal::State{odometer, odometer / 2, 1000};
+}
+
+// The journal file whose newest valid record holds `odometer`.
+static const char *fileHolding(std::int32_t odometer)
+{
+    for (const char *name : journalFiles)
+    {
+        MaintenanceJournal single(name, "journal_none.jnl");
+        MaintenanceJournal::State state;
+        if (single.recover(state) && state.odometer == odometer)
+        {
+            return name;
+        }
+    }
+    return nullptr;
+}
+
+TEST(journalRecoversNewestRecord)
+{
+    removeJournal();
+    MaintenanceJournal::State state;
+    {
+        MaintenanceJournal journal(journalFiles[0], journalFiles[1]);
+        CHECK(!journal.recover(state));
+        for (std::int32_t odometer = 100; odometer <= 500; odometer += 100)
+        {
+            CHECK(journal.append(stateAt(odometer)));
+        }
+    }
+    MaintenanceJournal reopened(journalFiles[0], journalFiles[1]);
+    CHECK(reopened.recover(state));
+    CHECK(state == stateAt(500));
+    CHECK(reopened.getSequence() == 5);
+}
+
+TEST(journalSurvivesTornAppend)
+{
+    removeJournal();
+    {
+        MaintenanceJournal journal(journalFiles[0], journalFiles[1]);
+        for (std::int32_t odometer = 100; odometer <= 300; odometer += 100)
+        {
+            journal.append(stateAt(odometer));
+        }
+    }
+    // Power lost halfway through the last record.
+    const char *active = fileHolding(300);
+    CHECK(active != nullptr);
+    std::filesystem::resize_file(active, std::filesystem::file_size(active) - journalRecordSize / 2);
+
+    MaintenanceJournal journal(journalFiles[0], journalFiles[1]);
+    MaintenanceJournal::State state;
+    CHECK(journal.recover(state));
+    CHECK(state == stateAt(200));
+
+    // The next write goes to the other file, never after the torn record.
+    CHECK(journal.append(stateAt(400)));
+    CHECK(std::filesystem::file_size(active) % journalRecordSize != 0);
+    MaintenanceJournal reopened(journalFiles[0], journalFiles[1]);
+    CHECK(reopened.recover(state));
+    CHECK(state == stateAt(400));
+}
+
+TEST(journalSkipsRecordWithBadCrc)
+{
+    removeJournal();
+    {
+        MaintenanceJournal journal(journalFiles[0], journalFiles[1]);
+        journal.append(stateAt(100));
+        journal.append(stateAt(200));
+    }
+    const char *active = fileHolding(200);
+    CHECK(active != nullptr);
+    {
+        // Flip the odometer of the newest record, leaving its CRC.
+        std::fstream file(active, std::ios::binary | std::ios::in | std::ios::out);
+        const std::streamoff odometerOffset = static_cast<std::streamoff>(std::filesystem::file_size(active) - journalRecordSize + 8);
+        file.seekp(odometerOffset);
+        file.put('\x7f');
+    }
+    MaintenanceJournal journal(journalFiles[0], journalFiles[1]);
+    MaintenanceJournal::State state;
+    CHECK(journal.recover(state));
+    CHECK(state == stateAt(100));
+}
+
+TEST(journalCompactionKeepsPreviousFile)
+{
+    removeJournal();
+    MaintenanceJournal journal(journalFiles[0], journalFiles[1]);
+    MaintenanceJournal::State state;
+    journal.recover(state);
+    const std::int32_t appends = MaintenanceJournal::recordsPerFile + 3;
+    for (std::int32_t i = 1; i <= appends; ++i)
+    {
+        CHECK(journal.append(stateAt(i)));
+    }
+    // Both files stay bounded: the first filled up, the second took over after compaction.
+    CHECK(std::filesystem::file_size(journalFiles[0]) == MaintenanceJournal::recordsPerFile * journalRecordSize);
+    CHECK(std::filesystem::file_size(journalFiles[1]) == 3 * journalRecordSize);
+
+    // A compaction cut off by power loss leaves a partial new file; the full one still recovers.
+    std::filesystem::resize_file(journalFiles[1], 10);
+    MaintenanceJournal reopened(journalFiles[0], journalFiles[1]);
+    CHECK(reopened.recover(state));
+    CHECK(state == stateAt(MaintenanceJournal::recordsPerFile));
+}
+
+TEST(olderMaintenanceFileIsReadWithoutAJournal)
+{
+    std::filesystem::remove("maint_a.jnl");
+    std::filesystem::remove("maint_b.jnl");
+    std::ofstream("legacy_maintenance.txt", std::ios::trunc) << "ODOMETER=750\nlast_service=400\nService_Interval=1500\nUNKNOWN=3\n";
+
+    configManager config("legacy.cfg", "legacy_maintenance.txt");
+    CHECK(config.getOdometer() == 750);
+    CHECK(config.getLastService() == 400);
+    CHECK(config.getServiceInterval() == 1500);
+}
@@ -0,0 +1,159 @@
+#include "vex.h"
+#include "testing.h"
+
+/// @brief Stands in for vex::motor and counts the device writes.
+struct FakeMotor
+{
+    void spin(vex::directionType, double volts, vex::voltageUnits)
+    {
+        ++spins;
+        lastVolts = volts;
+    }
+    void stop(vex::brakeType mode)
+    {
+        ++stops;
+        lastStop = mode;
+    }
+
+    int spins = 0;
+    int stops = 0;
+    double lastVolts = 0;
+    vex::brakeType lastStop = vex::brakeType::undefined;
+};
+
+struct Batch
+{
+    std::array<FakeMotor, 2> motors;
+    MotorCommandBatch<FakeMotor, 2> batch{{&motors[0], &motors[1]}, 0.05, 20};
+};
+
+TEST(batchWritesOnlyTheLastCommandOfATick)
+{
+    Batch b;
+    b.batch.set(0, 3);
+    b.batch.set(0, 6);
+    b.batch.setAll({9, -2});
+    b.batch.flush(0);
+    CHECK(b.motors[0].spins == 1);
+    CHECK_NEAR(b.motors[0].lastVolts, 9, 1e-12);
+    CHECK(b.motors[1].spins == 1);
+
+    // Nothing set this tick: nothing written.
+    b.batch.flush(10);
+    CHECK(b.motors[0].spins == 1);
+    CHECK(b.batch.getTotalWrites() == 2);
+}
+
+TEST(batchSkipsChangesBelowTheThreshold)
+{
+    Batch b;
+    b.batch.set(0, 6);
+    b.batch.flush(0);
+    b.batch.set(0, 6.03);
+    b.batch.flush(10);
+    CHECK(b.motors[0].spins == 1);
+    CHECK(b.batch.getSkippedWrites() == 1);
+
+    // Measured against the value written, so slow creep is still written once it adds up.
+    b.batch.set(0, 6.06);
+    b.batch.flush(20);
+    CHECK(b.motors[0].spins == 2);
+    CHECK_NEAR(b.motors[0].lastVolts, 6.06, 1e-12);
+}
+
+TEST(batchAlwaysWritesAStop)
+{
+    Batch b;
+    b.batch.set(0, 0.02);
+    b.batch.flush(0);
+    b.batch.set(0, 0);
+    b.batch.flush(10);
+    CHECK(b.motors[0].spins == 2);
+    CHECK_NEAR(b.motors[0].lastVolts, 0, 1e-12);
+
+    // But not again while it stays stopped.
+    b.batch.set(0, 0);
+    b.batch.flush(20);
+    CHECK(b.motors[0].spins == 2);
+}
+
+TEST(batchRefreshesUnchangedCommands)
+{
+    Batch b;
+    for (int tick = 0; tick < 40; ++tick)
+    {
+        b.batch.set(0, 6);
+        b.batch.flush(tick * 10);
+    }
+    // The first write, then one refresh every 20 ticks.
+    CHECK(b.motors[0].spins == 3);
+}
+
+TEST(batchHoldsOnceAndResumes)
+{
+    Batch b;
+    b.batch.set(0, 6);
+    b.batch.flush(0);
+    b.batch.hold(0);
+    b.batch.hold(0);
+    CHECK(b.motors[0].stops == 1);
+    CHECK(b.motors[0].lastStop == vex::brakeType::hold);
+
+    // The same voltage as before the hold is written again, since the motor is now holding.
+    b.batch.set(0, 6);
+    b.batch.flush(10);
+    CHECK(b.motors[0].spins == 2);
+    b.batch.hold(0);
+    CHECK(b.motors[0].stops == 2);
+}
+
+TEST(batchRebindAndInvalidateForceAWrite)
+{
+    Batch b;
+    FakeMotor replacement;
+    b.batch.setAll({6, 6});
+    b.batch.flush(0);
+
+    b.batch.rebind(0, &replacement);
+    b.batch.setAll({6, 6});
+    b.batch.flush(10);
+    CHECK(replacement.spins == 1);
+    CHECK(b.motors[0].spins == 1);
+    CHECK(b.motors[1].spins == 1);
+
+    b.batch.invalidate();
+    b.batch.setAll({6, 6});
+    b.batch.flush(20);
+    CHECK(replacement.spins == 2);
+    CHECK(b.motors[1].spins == 2);
+}
+
+TEST(batchCountsWritesPerSecond)
+{
+    Batch b;
+    for (int tick = 0; tick <= 100; ++tick)
+    {
+        b.batch.setAll({tick * 0.1, 1});
+        b.batch.flush(tick * 10);
+    }
+    // Over the first second motor 0 changes on all 101 ticks; motor 1 is written once and refreshed 5 times.
+    CHECK(b.batch.getWritesPerSecond() == 107);
+}
+
+TEST(driveSystemWritesEachMotorAtMostOncePerTick)
+{
+    Devices.begin();
+    DriveSystem drive(10);
+    drive.configure(configManager::DriveMode::SplitArcade);
+    SensorFrame frame;
+    frame.sticks.axes = {20, 0, 60, 0};
+    for (int tick = 0; tick < 100; ++tick)
+    {
+        frame.timestampMs = tick * 10;
+        const std::uint32_t before = drive.getDeviceWrites();
+        drive.tick(frame);
+        CHECK(drive.getDeviceWrites() - before <= WheelCount);
+    }
+    // A steady stick settles to refresh writes only.
+    CHECK(drive.getDeviceWrites() < 100 * WheelCount / 2);
+}
@@ -0,0 +1,99 @@
+#include "vex.h"
+#include "testing.h"
+#include <atomic>
+#include <thread>
+
+static Odometry::Settings wheelHeading()
+{
+    Odometry::Settings settings;
+    settings.useImuHeading = false;
+    return settings;
+}
+
+TEST(odometryIntegratesStraightAndArcMotion)
+{
+    Odometry odometry(wheelHeading());
+    const double travel = wheelTravelMm / 1000.0;
+    odometry.update(0, 0, 0, 0.01);
+
+    odometry.update(1, 1, 0, 0.01);
+    CHECK_NEAR(odometry.getPose().x, travel, 1e-9);
+    CHECK_NEAR(odometry.getPose().y, 0, 1e-9);
+    CHECK_NEAR(odometry.getPose().velocity, travel / 0.01, 1e-6);
+
+    // A quarter turn to the left about the left wheel: the centre ends up r forward and r left.
+    const double halfTrack = trackWidthMm / 2000.0;
+    const double rightRevs = M_PI / 2 * 2 * halfTrack / travel;
+    odometry.update(1, 1 + rightRevs, 0, 0.01);
+    CHECK_NEAR(odometry.getPose().theta, M_PI / 2, 1e-9);
+    CHECK_NEAR(odometry.getPose().x, travel + halfTrack, 1e-9);
+    CHECK_NEAR(odometry.getPose().y, halfTrack, 1e-9);
+}
+
+TEST(odometryAppliesResetOnTheNextUpdate)
+{
+    Odometry odometry;
+    odometry.update(5, 5, 0.3, 0.01);
+    odometry.update(6, 6, 0.3, 0.01);
+    const Pose before = odometry.getPose();
+
+    Pose start;
+    start.x = 1;
+    start.y = 2;
+    start.theta = 0.5;
+    odometry.reset(start);
+    CHECK(odometry.isResetPending());
+    CHECK_NEAR(odometry.getPose().x, before.x, 1e-12);
+
+    // The update that applies the reset takes new baselines instead of integrating the jump.
+    odometry.update(40, 40, 1.2, 0.01, 1234);
+    CHECK(!odometry.isResetPending());
+    CHECK_NEAR(odometry.getPose().x, 1, 1e-12);
+    CHECK_NEAR(odometry.getPose().y, 2, 1e-12);
+    CHECK_NEAR(odometry.getPose().theta, 0.5, 1e-12);
+    CHECK(odometry.getPose().timestampMs == 1234);
+
+    odometry.update(40, 40, 1.2 + 0.1, 0.01);
+    CHECK_NEAR(odometry.getPose().theta, 0.6, 1e-12);
+    CHECK_NEAR(odometry.getPose().x, 1, 1e-12);
+}
+
+TEST(odometryResetsFromOtherThreadsDuringUpdates)
+{
+    Odometry odometry;
+    std::atomic<bool> running{true};
+    std::atomic<std::uint32_t> torn{0};
+
+    // Every pose written is (k, k, k): the robot does not move, so any mix of fields is a torn write.
+    auto resetter = [&](double base)
+    {
+        for (int k = 0; running; ++k)
+        {
+            Pose pose;
+            pose.x = pose.y = pose.theta = base + k;
+            odometry.reset(pose);
+        }
+    };
+    std::thread first(resetter, 0.0);
+    std::thread second(resetter, 1e6);
+    std::thread reader([&]()
+                       {
+                           while (running)
+                           {
+                               const Pose pose = odometry.getPose();
+                               if (pose.x != pose.y || pose.x != pose.theta)
+                               {
+                                   ++torn;
+                               }
+                           } });
+
+    for (int tick = 0; tick < 20000; ++tick)
+    {
+        odometry.update(0, 0, 0, 0.01);
+    }
+    running = false;
+    first.join();
+    second.join();
+    reader.join();
+    CHECK(torn == 0);
+}
@@ -0,0 +1,158 @@
+#include "vex.h"
+#include "testing.h"
+
+using Action = OptionMenu::Action;
+using Type = ButtonEvent::Type;
+using DriveMode = configManager::DriveMode;
+
+static ButtonEvent buttonEvent(ControllerButton button, Type type = Type::Press, std::uint8_t controllerIndex = 0)
+{
+    ButtonEvent event;
+    event.type = type;
+    event.controllerIndex = controllerIndex;
+    event.button = button;
+    return event;
+}
+
+static const std::vector<std::string> sixOptions = {"One", "Two", "Three", "Four", "Five", "Six"};
+
+TEST(optionMenuSelectsAVisibleOption)
+{
+    OptionMenu menu;
+    CHECK(menu.handle(buttonEvent(ControllerButton::A)) == Action::None); // Not open yet
+    menu.open("Pick", sixOptions);
+    CHECK(menu.isOpen());
+
+    // Only presses on the primary controller count.
+    CHECK(menu.handle(buttonEvent(ControllerButton::B, Type::Press, 1)) == Action::None);
+    CHECK(menu.handle(buttonEvent(ControllerButton::B, Type::Release)) == Action::None);
+    CHECK(menu.handle(buttonEvent(ControllerButton::B, Type::LongPress)) == Action::None);
+    CHECK(menu.handle(buttonEvent(ControllerButton::R1)) == Action::Invalid);
+    CHECK(menu.isOpen());
+
+    CHECK(menu.handle(buttonEvent(ControllerButton::B)) == Action::Selected);
+    CHECK(menu.getState() == OptionMenu::State::Selected);
+    CHECK(menu.getSelectedOption() == "Two");
+    CHECK(menu.handle(buttonEvent(ControllerButton::A)) == Action::None); // Already decided
+}
+
+TEST(optionMenuScrollsWithAutoRepeat)
+{
+    OptionMenu menu;
+    menu.open("Pick", sixOptions);
+    CHECK(menu.handle(buttonEvent(ControllerButton::Down)) == Action::Scrolled);
+    CHECK(menu.handle(buttonEvent(ControllerButton::Down, Type::Repeat)) == Action::Scrolled);
+    // Six options, four buttons: the last page starts at the third option.
+    CHECK(menu.handle(buttonEvent(ControllerButton::Down, Type::Repeat)) == Action::Scrolled);
+    // A repeat of a select button does not pick anything.
+    CHECK(menu.handle(buttonEvent(ControllerButton::A, Type::Repeat)) == Action::None);
+    CHECK(menu.handle(buttonEvent(ControllerButton::Y)) == Action::Selected);
+    CHECK(menu.getSelectedOption() == "Six");
+
+    menu.open("Pick", sixOptions);
+    menu.handle(buttonEvent(ControllerButton::Down));
+    menu.handle(buttonEvent(ControllerButton::Up, Type::Repeat));
+    menu.handle(buttonEvent(ControllerButton::Up, Type::Repeat));
+    CHECK(menu.handle(buttonEvent(ControllerButton::A)) == Action::Selected);
+    CHECK(menu.getSelectedOption() == "One");
+}
+
+TEST(optionMenuCancelsOnlyWhenCancellable)
+{
+    OptionMenu menu;
+    menu.open("Pick", sixOptions);
+    CHECK(menu.handle(buttonEvent(ControllerButton::Left)) == Action::Invalid);
+    CHECK(menu.isOpen());
+
+    menu.open("Pick", sixOptions, true);
+    CHECK(menu.handle(buttonEvent(ControllerButton::Left)) == Action::Cancelled);
+    CHECK(menu.getState() == OptionMenu::State::Cancelled);
+
+    menu.open("Pick", {});
+    CHECK(menu.getState() == OptionMenu::State::Cancelled);
+}
+
+TEST(optionMenuRedrawsOnlyAfterAChange)
+{
+    OptionMenu menu;
+    CHECK(!menu.render(primaryController));
+    menu.open("Pick", sixOptions);
+    CHECK(menu.render(primaryController));
+    CHECK(!menu.render(primaryController));
+
+    menu.handle(buttonEvent(ControllerButton::R2)); // Invalid
+    menu.handle(buttonEvent(ControllerButton::Up)); // Already at the top
+    CHECK(!menu.render(primaryController));
+
+    menu.handle(buttonEvent(ControllerButton::Down));
+    CHECK(menu.render(primaryController));
+    menu.handle(buttonEvent(ControllerButton::Down));
+    menu.handle(buttonEvent(ControllerButton::Down, Type::Repeat)); // Past the last page
+    CHECK(menu.render(primaryController));
+    CHECK(!menu.render(primaryController));
+}
+
+TEST(driveTickKeepsItsPeriodWhileTheMenuIsOpen)
+{
+    // The drive tick of userControl, stepped on a virtual clock. Between ticks the test plays the
+    // UI task: it feeds the menu its button events and draws it.
+    Devices.begin();
+    const DriveMode savedMode = ConfigManager.getDriveMode();
+    CHECK(ConfigManager.getMenuStopsDrive()); // MENUSTOPSDRIVE defaults to true
+    DriveSystem drive(10);
+    drive.configure(DriveMode::SplitArcade);
+    DriveModeMenu menu;
+    const vex::host::MotorState &frontLeft = vex::host::motor(Devices.motor(configManager::Device::FrontLeftMotor).index());
+
+    VirtualClock::nowUs = 0;
+    PeriodicScheduler scheduler(VirtualClock::clock());
+    std::vector<std::uint64_t> starts;
+    std::vector<DriveMode> modes;
+    scheduler.addTask("drive", 10, 0, [&]()
+                      {
+                          starts.push_back(VirtualClock::nowUs);
+                          menu.applyPendingMode(drive);
+                          modes.push_back(drive.getDriveMode());
+                          SensorFrame frame;
+                          frame.sticks.axes = {0, 0, 100, 0}; // Full forward on the left stick
+                          if (menu.holdsDrive())
+                          {
+                              frame.sticks = StickSample{};
+                          }
+                          drive.tick(frame);
+                          VirtualClock::nowUs += 2000; // The tick's own run time
+                      });
+    auto runTicks = [&](int count)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            scheduler.runOnce();
+            menu.render(primaryController);
+        }
+    };
+
+    runTicks(5);
+    CHECK(frontLeft.commandVolts > 1);
+
+    menu.handle(buttonEvent(ControllerButton::Up));
+    CHECK(menu.isOpen());
+    runTicks(5);
+    CHECK(frontLeft.commandVolts == 0);
+
+    menu.handle(buttonEvent(ControllerButton::Down, Type::Repeat)); // Four modes fit; nothing to scroll
+    menu.handle(buttonEvent(ControllerButton::Y));                  // Tank
+    CHECK(!menu.isOpen());
+    CHECK(drive.getDriveMode() == DriveMode::SplitArcade); // Not until the next tick starts
+    runTicks(5);
+    CHECK(modes[10] == DriveMode::Tank);
+    CHECK(frontLeft.commandVolts > 1); // Tank: Axis3 is the left side
+
+    for (std::size_t i = 0; i < starts.size(); ++i)
+    {
+        CHECK(starts[i] == i * 10000);
+    }
+    CHECK(scheduler.getStats(0).overruns == 0);
+    CHECK(scheduler.getStats(0).skippedPeriods == 0);
+    CHECK(ConfigManager.getDriveMode() == DriveMode::Tank);
+    ConfigManager.setDriveMode(savedMode);
+}
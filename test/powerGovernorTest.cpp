@@ -0,0 +1,114 @@
+#include "vex.h"
+#include "testing.h"
+
+using DrivePriority = configManager::DrivePriority;
+
+static PowerGovernor::Settings budget(double amps, DrivePriority priority)
+{
+    PowerGovernor::Settings settings;
+    settings.budgetAmps = amps;
+    settings.priority = priority;
+    return settings;
+}
+
+static double predictedAmps(const WheelVolts &volts, double ampsPerVolt = PowerGovernor::Settings{}.initialAmpsPerVolt)
+{
+    double amps = 0;
+    for (double v : volts.volts)
+    {
+        amps += ampsPerVolt * std::abs(v);
+    }
+    return amps;
+}
+
+static const std::array<double, WheelCount> noCurrent{};
+
+TEST(governorLeavesCommandsWithinBudgetAlone)
+{
+    PowerGovernor governor(budget(8, DrivePriority::Turn));
+    WheelVolts volts = WheelVolts::fromSides(6, 4);
+    governor.apply(volts, noCurrent);
+    CHECK_NEAR(volts.volts[0], 6, 1e-12);
+    CHECK_NEAR(volts.volts[2], 4, 1e-12);
+    CHECK_NEAR(governor.getScale(), 1, 1e-12);
+}
+
+TEST(governorKeepsTheTurnWhenTurnHasPriority)
+{
+    PowerGovernor governor(budget(4, DrivePriority::Turn));
+    WheelVolts volts = WheelVolts::fromSides(10, 2); // forward 6, turn 4
+    governor.apply(volts, noCurrent);
+    CHECK_NEAR(volts.volts[0] - volts.volts[2], 8, 1e-9);
+    CHECK(volts.volts[0] + volts.volts[2] < 12);
+    CHECK(volts.volts[0] + volts.volts[2] > 0);
+    CHECK(predictedAmps(volts) <= 4 + 1e-9);
+    CHECK(governor.getScale() < 1);
+}
+
+TEST(governorKeepsForwardWhenForwardHasPriority)
+{
+    PowerGovernor governor(budget(4, DrivePriority::Forward));
+    WheelVolts volts = WheelVolts::fromSides(8, -4); // forward 2, turn 6
+    governor.apply(volts, noCurrent);
+    CHECK_NEAR(volts.volts[0] + volts.volts[2], 4, 1e-9);
+    CHECK(volts.volts[0] - volts.volts[2] < 12);
+    CHECK(volts.volts[0] - volts.volts[2] > 0);
+    CHECK(predictedAmps(volts) <= 4 + 1e-9);
+}
+
+TEST(governorScalesThePriorityPartWhenItAloneIsOverBudget)
+{
+    PowerGovernor governor(budget(2, DrivePriority::Turn));
+    WheelVolts volts = WheelVolts::fromSides(10, 2); // turn alone predicts 3.36 A
+    governor.apply(volts, noCurrent);
+    CHECK_NEAR(volts.volts[0], -volts.volts[2], 1e-9); // Forward dropped.
+    CHECK_NEAR(predictedAmps(volts), 2, 1e-9);
+}
+
+TEST(governorLearnsMotorCurrentPerVolt)
+{
+    PowerGovernor governor(budget(8, DrivePriority::Turn));
+    WheelVolts volts = WheelVolts::fromSides(12, 12);
+    std::array<double, WheelCount> amps{};
+
+    // Free spinning at speed: little current per volt, so full voltage fits the budget.
+    amps.fill(0.5);
+    for (int tick = 0; tick < 20; ++tick)
+    {
+        volts = WheelVolts::fromSides(12, 12);
+        governor.apply(volts, amps);
+    }
+    CHECK_NEAR(volts.volts[0], 12, 1e-9);
+    CHECK_NEAR(governor.getTotalAmps(), 2, 1e-9);
+    CHECK_NEAR(governor.getHeadroomAmps(), 6, 1e-9);
+
+    // Pushing a wall: 2.5 A per motor at the last voltage sent. The command comes down so the
+    // predicted current, at the learned rate, meets the budget.
+    for (int tick = 0; tick < 20; ++tick)
+    {
+        for (std::size_t i = 0; i < WheelCount; ++i)
+        {
+            amps[i] = 2.5 * std::abs(volts.volts[i]) / 12;
+        }
+        volts = WheelVolts::fromSides(12, 12);
+        governor.apply(volts, amps);
+    }
+    CHECK_NEAR(predictedAmps(volts, 2.5 / 12), 8, 0.05);
+    CHECK(volts.volts[0] < 12);
+}
+
+TEST(governorResetForgetsWhatItLearned)
+{
+    PowerGovernor governor(budget(4, DrivePriority::Turn));
+    std::array<double, WheelCount> amps;
+    amps.fill(0.1);
+    for (int tick = 0; tick < 20; ++tick)
+    {
+        WheelVolts volts = WheelVolts::fromSides(12, 12);
+        governor.apply(volts, amps);
+    }
+    governor.reset();
+    WheelVolts volts = WheelVolts::fromSides(12, 12);
+    governor.apply(volts, noCurrent);
+    CHECK_NEAR(predictedAmps(volts), 4, 1e-9);
+}
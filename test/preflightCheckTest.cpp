@@ -0,0 +1,187 @@
+#include "vex.h"
+#include "testing.h"
+
+/**
+ * A drive motor on a free wheel: it turns at degPerVoltSecond and draws ampsPerVolt while
+ * spun, integrated against VirtualClock.
+ */
+struct FakeMotorState
+{
+    bool installed = true;
+    double temperatureC = 30;
+    double degPerVoltSecond = 60;
+    double ampsPerVolt = 0.3;
+    double volts = 0;
+    double positionDeg = 0;
+    std::uint64_t sinceUs = 0;
+    int spinCalls = 0;
+    bool coasted = false;
+
+    void advance()
+    {
+        positionDeg += volts * degPerVoltSecond * (VirtualClock::nowUs - sinceUs) / 1e6;
+        sinceUs = VirtualClock::nowUs;
+    }
+};
+
+struct FakeMotor
+{
+    FakeMotorState *state;
+
+    bool installed() { return state->installed; }
+    double temperatureC() { return state->temperatureC; }
+    double positionDeg()
+    {
+        state->advance();
+        return state->positionDeg;
+    }
+    double currentAmps() { return std::abs(state->volts) * state->ampsPerVolt; }
+    void spinVolts(double volts)
+    {
+        state->advance();
+        state->volts = volts;
+        ++state->spinCalls;
+    }
+    void coast()
+    {
+        state->advance();
+        state->volts = 0;
+        state->coasted = true;
+    }
+};
+
+/// An IMU that turns with the difference between a left and a right motor, plus a drift.
+struct FakeImu
+{
+    FakeMotorState *left;
+    FakeMotorState *right;
+    double driftDegPerSecond = 0;
+
+    bool installed() { return true; }
+    bool isCalibrating() { return false; }
+    double rotationDeg()
+    {
+        left->advance();
+        right->advance();
+        return (left->positionDeg - right->positionDeg) * 0.1 + driftDegPerSecond * VirtualClock::nowUs / 1e6;
+    }
+};
+
+using TestPreflight = PreflightCheck<FakeMotor, FakeImu, PeriodicScheduler::Clock>;
+
+static void resetFakes(FakeMotorState &left, FakeMotorState &right)
+{
+    VirtualClock::nowUs = 0;
+    left = FakeMotorState{};
+    right = FakeMotorState{};
+}
+
+TEST(preflightPassesHealthyDevices)
+{
+    FakeMotorState left, right;
+    resetFakes(left, right);
+    TestPreflight check(VirtualClock::clock());
+    check.addMotor("left", FakeMotor{&left});
+    check.addMotor("right", FakeMotor{&right});
+    check.addImu("imu", FakeImu{&left, &right});
+
+    CHECK(check.run());
+    CHECK(check.getResults().size() == 3);
+    CHECK(left.coasted && right.coasted);
+    CHECK(left.spinCalls == 2);
+    CHECK_NEAR(left.positionDeg, 0, 1e-6); // Forward and back again
+    CHECK(check.getElapsedUs() >= 340000);
+    CHECK(check.getElapsedUs() <= 500000);
+}
+
+TEST(preflightWatchesImuBeforePulses)
+{
+    // One side turns much faster, so the robot yaws during the pulses. That is not drift.
+    FakeMotorState left, right;
+    resetFakes(left, right);
+    left.degPerVoltSecond = 200;
+    TestPreflight check(VirtualClock::clock());
+    check.addMotor("left", FakeMotor{&left});
+    check.addMotor("right", FakeMotor{&right});
+    check.addImu("imu", FakeImu{&left, &right});
+    CHECK(check.run());
+
+    // A reading that creeps while the robot stands still is.
+    resetFakes(left, right);
+    FakeImu drifting{&left, &right, 20};
+    TestPreflight driftCheck(VirtualClock::clock());
+    driftCheck.addImu("imu", drifting);
+    CHECK(!driftCheck.run());
+    CHECK(driftCheck.getResults()[0].reason == "drifts 2.0 deg");
+}
+
+TEST(preflightReportsMotorFaults)
+{
+    FakeMotorState jammed, unplugged, hot, stuck;
+    VirtualClock::nowUs = 0;
+    jammed.ampsPerVolt = 1;
+    unplugged.installed = false;
+    hot.temperatureC = 60;
+    stuck.degPerVoltSecond = 0;
+    TestPreflight check(VirtualClock::clock());
+    check.addMotor("jammed", FakeMotor{&jammed});
+    check.addMotor("unplugged", FakeMotor{&unplugged});
+    check.addMotor("hot", FakeMotor{&hot});
+    check.addMotor("stuck", FakeMotor{&stuck});
+    CHECK(!check.run());
+    const auto &results = check.getResults();
+    CHECK(results[0].reason == "2.0A at 2V");
+    CHECK(results[1].reason == "not installed");
+    CHECK(results[2].reason == "60C");
+    CHECK(results[3].reason == "no encoder response");
+    CHECK(unplugged.spinCalls == 0 && hot.spinCalls == 0);
+}
+
+TEST(preflightWithoutPulsesMovesNothing)
+{
+    FakeMotorState left, right;
+    resetFakes(left, right);
+    left.degPerVoltSecond = 0; // Would fail a pulse
+    TestPreflight::Limits limits;
+    limits.pulseMotors = false;
+    TestPreflight check(VirtualClock::clock(), limits);
+    check.addMotor("left", FakeMotor{&left});
+    check.addImu("imu", FakeImu{&left, &right});
+    CHECK(check.run());
+    CHECK(left.spinCalls == 0);
+    CHECK(check.getElapsedUs() == 100000);
+}
+
+static bool anyBlockingMessage()
+{
+    for (const LoggedMessage &message : loggedMessages())
+    {
+        if (message.level >= Log::Level::Warn)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+TEST(runPreflightSkipsPulsesWhileFieldDisables)
+{
+    Devices.begin();
+    vex::host::competition().fieldControl = true;
+    vex::host::competition().enabled = false;
+    CHECK(runPreflight());
+    for (configManager::Device device : DeviceRegistry::driveMotors)
+    {
+        CHECK(vex::host::motor(Devices.motor(device).index()).spinCalls == 0);
+    }
+    CHECK(!anyBlockingMessage());
+}
+
+TEST(runPreflightReportsFailuresWithoutBlocking)
+{
+    // The host motors never turn, so every pulse fails; the boot must not wait on it.
+    Devices.begin();
+    CHECK(!runPreflight());
+    CHECK(vex::host::motor(Devices.motor(configManager::Device::FrontLeftMotor).index()).spinCalls == 2);
+    CHECK(!anyBlockingMessage());
+}
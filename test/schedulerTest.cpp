@@ -0,0 +1,147 @@
+#include "vex.h"
+#include "testing.h"
+
+TEST(schedulerRunsOnAbsoluteDeadlines)
+{
+    VirtualClock::nowUs = 0;
+    PeriodicScheduler scheduler(VirtualClock::clock());
+    std::vector<std::uint64_t> starts;
+    scheduler.addTask("work", 10, 0, [&]()
+                      { starts.push_back(VirtualClock::nowUs); VirtualClock::nowUs += 3000; });
+    for (int i = 0; i < 5; ++i)
+    {
+        scheduler.runOnce();
+    }
+    CHECK(starts == (std::vector<std::uint64_t>{0, 10000, 20000, 30000, 40000}));
+    CHECK(scheduler.getStats(0).overruns == 0);
+    CHECK(scheduler.getStats(0).maxRuntimeUs == 3000);
+}
+
+TEST(schedulerPhaseOffsetsSpreadTasks)
+{
+    VirtualClock::nowUs = 0;
+    PeriodicScheduler scheduler(VirtualClock::clock());
+    std::vector<std::pair<char, std::uint64_t>> runs;
+    scheduler.addTask("a", 10, 0, [&]()
+                      { runs.push_back({'a', VirtualClock::nowUs}); });
+    scheduler.addTask("b", 10, 5, [&]()
+                      { runs.push_back({'b', VirtualClock::nowUs}); });
+    for (int i = 0; i < 4; ++i)
+    {
+        scheduler.runOnce();
+    }
+    CHECK(runs == (std::vector<std::pair<char, std::uint64_t>>{{'a', 0}, {'b', 5000}, {'a', 10000}, {'b', 15000}}));
+}
+
+TEST(schedulerCatchesUpAfterSmallOverrun)
+{
+    // An iteration 1 us too long must not cost a whole period: the next one starts straight
+    // away and the task is back on its deadlines after that.
+    VirtualClock::nowUs = 0;
+    PeriodicScheduler scheduler(VirtualClock::clock());
+    std::vector<std::uint64_t> starts;
+    scheduler.addTask("work", 10, 0, [&]()
+                      {
+                          starts.push_back(VirtualClock::nowUs);
+                          VirtualClock::nowUs += starts.size() == 2 ? 10001 : 1000; });
+    for (int i = 0; i < 5; ++i)
+    {
+        scheduler.runOnce();
+    }
+    CHECK(starts == (std::vector<std::uint64_t>{0, 10000, 20001, 30000, 40000}));
+    CHECK(scheduler.getStats(0).overruns == 1);
+    CHECK(scheduler.getStats(0).skippedPeriods == 0);
+    CHECK(scheduler.getStats(0).maxJitterUs == 1);
+}
+
+TEST(schedulerKeepsRateDespiteFrequentOverruns)
+{
+    // A replay recorded at 100 Hz must still run 100 ticks per second when every tenth tick
+    // overruns slightly.
+    VirtualClock::nowUs = 0;
+    PeriodicScheduler scheduler(VirtualClock::clock());
+    int runs = 0;
+    scheduler.addTask("replay", 10, 0, [&]()
+                      { VirtualClock::nowUs += ++runs % 10 == 0 ? 10500 : 2000; });
+    while (VirtualClock::nowUs < 1000000)
+    {
+        scheduler.runOnce();
+    }
+    CHECK(runs >= 100 && runs <= 101);
+    CHECK(scheduler.getStats(0).skippedPeriods == 0);
+}
+
+TEST(schedulerSkipsPeriodsAfterLongStall)
+{
+    // Beyond maxCatchUpPeriods a stalled task drops the excess instead of bursting.
+    VirtualClock::nowUs = 0;
+    PeriodicScheduler scheduler(VirtualClock::clock());
+    std::vector<std::uint64_t> starts;
+    scheduler.addTask("work", 10, 0, [&]()
+                      {
+                          starts.push_back(VirtualClock::nowUs);
+                          VirtualClock::nowUs += starts.size() == 1 ? 55000 : 1000; });
+    for (int i = 0; i < 5; ++i)
+    {
+        scheduler.runOnce();
+    }
+    // Finished at 55 ms with the 10 ms deadline missed by 4.5 periods: 10, 20 and 30 ms are
+    // skipped, 40 and 50 ms run back to back and 60 ms is on time.
+    CHECK(scheduler.getStats(0).skippedPeriods == 3);
+    CHECK(starts == (std::vector<std::uint64_t>{0, 55000, 56000, 60000, 70000}));
+}
+
+TEST(schedulerSetPeriodAppliesAfterNextRun)
+{
+    VirtualClock::nowUs = 0;
+    PeriodicScheduler scheduler(VirtualClock::clock());
+    std::vector<std::uint64_t> starts;
+    const std::size_t id = scheduler.addTask("work", 10, 0, [&]()
+                                             { starts.push_back(VirtualClock::nowUs); });
+    scheduler.runOnce();
+    scheduler.setPeriod(id, 20);
+    scheduler.runOnce();
+    scheduler.runOnce();
+    CHECK(starts == (std::vector<std::uint64_t>{0, 10000, 30000}));
+}
+
+TEST(schedulerStatsAreLoggedByTheLogThread)
+{
+    VirtualClock::nowUs = 0;
+    PeriodicScheduler scheduler(VirtualClock::clock());
+    scheduler.addTask("stats", 10, 0, [&]()
+                      { scheduler.logStats(); });
+    scheduler.runOnce();
+    CHECK(loggedMessages().empty());
+
+    std::thread logThread(flushDeferredLogs);
+    const std::thread::id logThreadId = logThread.get_id();
+    logThread.join();
+    const std::vector<LoggedMessage> logged = loggedMessages();
+    CHECK(logged.size() == 1);
+    CHECK(!logged.empty() && logged[0].functionName == "PeriodicScheduler" && logged[0].thread == logThreadId);
+}
+
+TEST(deferredLogKeepsLevelAndCutsLongMessages)
+{
+    logDeferred("module", std::string(500, 'x'), Log::Level::Warn, 3);
+    flushDeferredLogs();
+    const std::vector<LoggedMessage> logged = loggedMessages();
+    CHECK(logged.size() == 1);
+    CHECK(!logged.empty() && logged[0].level == Log::Level::Warn && logged[0].timeOfDisplay == 3);
+    CHECK(!logged.empty() && logged[0].message.size() < 500 && logged[0].message.find_first_not_of('x') == std::string::npos);
+}
+
+TEST(deferredLogDropsWhenFullAndSaysSo)
+{
+    int queued = 0;
+    for (int i = 0; i < 40; ++i)
+    {
+        queued += logDeferred("module", std::to_string(i), Log::Level::Debug);
+    }
+    flushDeferredLogs();
+    const std::vector<LoggedMessage> logged = loggedMessages();
+    CHECK(queued == 32);
+    CHECK(logged.size() == 33);
+    CHECK(!logged.empty() && logged.back().functionName == "logDeferred");
+}
@@ -0,0 +1,102 @@
+#include "vex.h"
+#include "testing.h"
+
+// The drive ticks every 25 ms, the button service samples every 10 ms.
+constexpr double tickSeconds = 0.025;
+
+static StickSample forwardStick(int percent)
+{
+    StickSample sticks;
+    sticks.axes[2] = percent;
+    return sticks;
+}
+
+TEST(latencyStartsWhenButtonServiceSeesChange)
+{
+    VirtualClock::nowUs = 1000000;
+    SessionMetrics metrics(VirtualClock::now);
+    metrics.noteControllerSticks(forwardStick(0));
+    metrics.noteInput(forwardStick(0), tickSeconds);
+    metrics.noteOutput(DriveCommand{}, 0);
+
+    // The service sees the stick move 15 ms before the next drive tick reads it.
+    VirtualClock::nowUs += 10000;
+    metrics.noteControllerSticks(forwardStick(60));
+    VirtualClock::nowUs += 15000;
+    metrics.noteInput(forwardStick(60), tickSeconds);
+    VirtualClock::nowUs += 300;
+    metrics.noteOutput(DriveCommand{7.2, 0}, 4);
+
+    const SessionMetrics::LatencyStats stats = metrics.getLatency();
+    CHECK(stats.samples == 1);
+    CHECK(stats.maxUs == 15300);
+    CHECK(stats.missedTicks == 0);
+}
+
+TEST(latencyIgnoresChangeThatMovesNoCommand)
+{
+    VirtualClock::nowUs = 1000000;
+    SessionMetrics metrics(VirtualClock::now);
+    metrics.noteInput(forwardStick(0), tickSeconds);
+    metrics.noteOutput(DriveCommand{}, 0);
+
+    // Inside the deadzone: the command stays at 0 V while a wheel stage rewrites the motors.
+    VirtualClock::nowUs += 25000;
+    metrics.noteInput(forwardStick(8), tickSeconds);
+    metrics.noteOutput(DriveCommand{}, 4);
+    for (int tick = 0; tick < 40; ++tick)
+    {
+        VirtualClock::nowUs += 25000;
+        metrics.noteInput(forwardStick(8), tickSeconds);
+        metrics.noteOutput(DriveCommand{}, 8 + tick * 4);
+    }
+    const SessionMetrics::LatencyStats stats = metrics.getLatency();
+    CHECK(stats.samples == 0);
+    CHECK(stats.unanswered == 0);
+}
+
+TEST(latencyWaitsForWriteAfterCommandMoves)
+{
+    VirtualClock::nowUs = 1000000;
+    SessionMetrics metrics(VirtualClock::now);
+    metrics.noteInput(forwardStick(0), tickSeconds);
+    metrics.noteOutput(DriveCommand{}, 0);
+
+    // The command moves a little, below the write threshold; the write lands a tick later.
+    VirtualClock::nowUs += 25000;
+    metrics.noteInput(forwardStick(20), tickSeconds);
+    metrics.noteOutput(DriveCommand{0.05, 0}, 0);
+    VirtualClock::nowUs += 25000;
+    metrics.noteInput(forwardStick(20), tickSeconds);
+    metrics.noteOutput(DriveCommand{0.1, 0}, 4);
+
+    const SessionMetrics::LatencyStats stats = metrics.getLatency();
+    CHECK(stats.samples == 1);
+    CHECK(stats.maxUs == 25000);
+}
+
+TEST(latencyCountsMissedTicksAndUnansweredChanges)
+{
+    VirtualClock::nowUs = 1000000;
+    SessionMetrics metrics(VirtualClock::now);
+    metrics.noteInput(forwardStick(0), tickSeconds);
+    metrics.noteOutput(DriveCommand{}, 0);
+
+    // One tick ran 60 ms late: two ticks were skipped.
+    VirtualClock::nowUs += 85000;
+    metrics.noteInput(forwardStick(50), tickSeconds);
+    metrics.noteOutput(DriveCommand{6, 0}, 0);
+    CHECK(metrics.getLatency().missedTicks == 2);
+
+    // No write ever follows.
+    for (int tick = 0; tick < 25; ++tick)
+    {
+        VirtualClock::nowUs += 25000;
+        metrics.noteInput(forwardStick(50), tickSeconds);
+        metrics.noteOutput(DriveCommand{6, 0}, 0);
+    }
+    const SessionMetrics::LatencyStats stats = metrics.getLatency();
+    CHECK(stats.unanswered == 1);
+    CHECK(stats.samples == 0);
+    CHECK(metrics.reportLines().back().find("(2 missed ticks)") != std::string::npos);
+}
@@ -0,0 +1,135 @@
+#include "vex.h"
+#include "testing.h"
+#include "drivetrainSim.h"
+
+struct StabilityRun
+{
+    double headingErrorDeg = 0; ///< At the end of the run.
+    double peakErrorDeg = 0;
+};
+
+// Drives straight at `forwardVolts` for two seconds with a yaw torque applied between 0.5 s and
+// `disturbanceEnd`, as from a bump (short) or a robot pushing on one corner (long).
+static StabilityRun driveThroughDisturbance(bool stabilityOn, double disturbanceNm, double disturbanceEnd)
+{
+    DrivetrainSim sim;
+    sim.setSpeed(0.5);
+    StabilityControl stability;
+    const double dt = 0.01;
+    StabilityRun run;
+    for (int tick = 0; tick < 200; ++tick)
+    {
+        const SensorFrame frame = sim.frame();
+        DriveCommand command;
+        command.forwardVolts = 6;
+        if (stabilityOn)
+        {
+            StabilityControl::Inputs inputs;
+            inputs.forwardVolts = command.forwardVolts;
+            inputs.turnVolts = command.turnVolts;
+            inputs.yawRateDps = frame.yawRateDps;
+            inputs.rotationDeg = frame.rotationDeg;
+            inputs.dtSeconds = dt;
+            command.turnVolts = stability.correctTurn(inputs);
+        }
+        const double t = tick * dt;
+        const double disturbance = t >= 0.5 && t < disturbanceEnd ? disturbanceNm : 0;
+        sim.step(WheelVolts::fromSides(command.leftVolts(), command.rightVolts()), dt, disturbance);
+        run.peakErrorDeg = std::max(run.peakErrorDeg, std::abs(sim.frame().rotationDeg));
+    }
+    run.headingErrorDeg = std::abs(sim.frame().rotationDeg);
+    return run;
+}
+
+TEST(stabilityControlRejectsABump)
+{
+    const StabilityRun off = driveThroughDisturbance(false, 4, 0.6);
+    const StabilityRun on = driveThroughDisturbance(true, 4, 0.6);
+    std::printf("  bump: heading error %.2f off / %.2f on deg, peak %.2f / %.2f\n", off.headingErrorDeg, on.headingErrorDeg, off.peakErrorDeg, on.peakErrorDeg);
+    CHECK(on.peakErrorDeg < off.peakErrorDeg / 2);
+    CHECK(on.headingErrorDeg < 1);
+}
+
+TEST(stabilityControlHoldsHeadingAgainstAPush)
+{
+    const StabilityRun off = driveThroughDisturbance(false, 1.5, 2.0);
+    const StabilityRun on = driveThroughDisturbance(true, 1.5, 2.0);
+    std::printf("  push: heading error %.2f off / %.2f on deg\n", off.headingErrorDeg, on.headingErrorDeg);
+    CHECK(on.headingErrorDeg < off.headingErrorDeg / 5);
+    CHECK(on.headingErrorDeg < 2);
+}
+
+TEST(stabilityControlTracksTheTurnStick)
+{
+    DrivetrainSim sim;
+    StabilityControl stability;
+    const double dt = 0.01;
+    StabilityControl::Inputs inputs;
+    inputs.turnVolts = 2; // 100 dps
+    inputs.dtSeconds = dt;
+    for (int tick = 0; tick < 150; ++tick)
+    {
+        const SensorFrame frame = sim.frame();
+        inputs.yawRateDps = frame.yawRateDps;
+        inputs.rotationDeg = frame.rotationDeg;
+        const double turn = stability.correctTurn(inputs);
+        sim.step(WheelVolts::fromSides(turn, -turn), dt);
+    }
+    CHECK_NEAR(sim.frame().yawRateDps, 100, 10);
+    CHECK(!stability.isHoldingHeading());
+}
+
+TEST(stabilityControlLatchesHeadingOnlyWhileDriving)
+{
+    StabilityControl stability;
+    StabilityControl::Inputs inputs;
+    inputs.rotationDeg = 30;
+    inputs.dtSeconds = 0.01;
+
+    inputs.forwardVolts = 0.2; // Creeping: below holdMinForwardVolts.
+    stability.correctTurn(inputs);
+    CHECK(!stability.isHoldingHeading());
+
+    inputs.forwardVolts = 6;
+    stability.correctTurn(inputs);
+    CHECK(stability.isHoldingHeading());
+    CHECK_NEAR(stability.getHeldHeading(), 30, 1e-9);
+
+    // Drifted right of the held heading: the correction turns left.
+    inputs.rotationDeg = 35;
+    CHECK(stability.correctTurn(inputs) < 0);
+    CHECK_NEAR(stability.getHeldHeading(), 30, 1e-9);
+
+    // The driver turning releases the hold; releasing both sticks resets it.
+    inputs.turnVolts = 3;
+    stability.correctTurn(inputs);
+    CHECK(!stability.isHoldingHeading());
+    inputs.forwardVolts = 0;
+    inputs.turnVolts = 0;
+    CHECK_NEAR(stability.correctTurn(inputs), 0, 1e-9);
+}
+
+TEST(stabilityControlLimitsAndDoesNotWindUp)
+{
+    StabilityControl::Settings settings;
+    StabilityControl stability(settings);
+    StabilityControl::Inputs inputs;
+    inputs.forwardVolts = 6;
+    inputs.turnVolts = 1;
+    inputs.dtSeconds = 0.01;
+    inputs.yawRateDps = -500; // Spinning hard the wrong way, e.g. held by another robot.
+    double turn = 0;
+    for (int tick = 0; tick < 500; ++tick)
+    {
+        turn = stability.correctTurn(inputs);
+    }
+    CHECK_NEAR(turn, inputs.turnVolts + settings.maxCorrectionVolts, 1e-9);
+
+    // Released: the rate matches the command, so the correction falls back within a few ticks.
+    inputs.yawRateDps = 50;
+    for (int tick = 0; tick < 5; ++tick)
+    {
+        turn = stability.correctTurn(inputs);
+    }
+    CHECK(std::abs(turn - inputs.turnVolts) < 1);
+}
@@ -0,0 +1,101 @@
+#include "vex.h"
+#include "testing.h"
+#include <atomic>
+#include <chrono>
+
+// Real time, counting every sleep: idle workers must block, never sleep-poll.
+static std::atomic<int> graphSleeps{0};
+static std::uint64_t graphNow()
+{
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+static void graphSleepUntil(std::uint64_t)
+{
+    ++graphSleeps;
+}
+static const PeriodicScheduler::Clock graphClock{graphNow, graphSleepUntil};
+
+TEST(startupGraphRunsStepsAfterDependencies)
+{
+    graphSleeps = 0;
+    StartupGraph graph(graphClock);
+    std::atomic<bool> done[5] = {};
+    std::atomic<int> orderErrors{0};
+    auto step = [&](int id, std::initializer_list<int> dependencies, int sleepMs)
+    {
+        std::vector<int> deps(dependencies);
+        return [&, id, deps, sleepMs]()
+        {
+            for (int dependency : deps)
+            {
+                orderErrors += done[dependency] ? 0 : 1;
+            }
+            vex::this_thread::sleep_for(sleepMs);
+            done[id] = true;
+        };
+    };
+    const auto config = graph.addStep("config", step(0, {}, 20));
+    const auto devices = graph.addStep("devices", step(1, {0}, 5), {config});
+    const auto gyro = graph.addStep("gyro", step(2, {1}, 60), {devices});
+    graph.addStep("logo", step(3, {0}, 40), {config});
+    graph.addStep("preflight", step(4, {2}, 10), {gyro});
+    graph.run();
+
+    CHECK(orderErrors == 0);
+    for (const auto &stepDone : done)
+    {
+        CHECK(stepDone);
+    }
+    CHECK(graphSleeps == 0);
+    // The logo overlaps the gyro, so the boot is the longest chain, not the sum.
+    CHECK(graph.getTiming(3).startUs < graph.getTiming(2).endUs);
+    CHECK(graph.getTotalUs() < 125000);
+    CHECK(graph.getTiming(4).readyUs == graph.getTiming(2).endUs);
+}
+
+TEST(startupGraphKeepsWorkerLimit)
+{
+    graphSleeps = 0;
+    StartupGraph graph(graphClock);
+    std::atomic<int> running{0};
+    std::atomic<int> peak{0};
+    std::atomic<int> finished{0};
+    for (int i = 0; i < 8; ++i)
+    {
+        graph.addStep("step" + std::to_string(i), [&]()
+                      {
+                          const int now = ++running;
+                          int seen = peak.load();
+                          while (now > seen && !peak.compare_exchange_weak(seen, now))
+                          {
+                          }
+                          vex::this_thread::sleep_for(10);
+                          --running;
+                          ++finished; });
+    }
+    graph.run(3);
+    CHECK(finished == 8);
+    CHECK(peak == 3);
+    CHECK(graphSleeps == 0);
+}
+
+TEST(startupGraphFanOutAfterLongStep)
+{
+    // Workers that found nothing to do have ended by the time the first step finishes; the
+    // steps it unblocks still run side by side.
+    StartupGraph graph(graphClock);
+    const auto first = graph.addStep("first", []
+                                     { vex::this_thread::sleep_for(20); });
+    for (int i = 0; i < 3; ++i)
+    {
+        graph.addStep("after" + std::to_string(i), []
+                      { vex::this_thread::sleep_for(40); }, {first});
+    }
+    graph.run(4);
+    for (std::size_t i = 1; i < graph.getStepCount(); ++i)
+    {
+        CHECK(graph.getTiming(i).startUs >= graph.getTiming(first).endUs);
+        CHECK(graph.getTiming(i).startUs < graph.getTiming(first).endUs + 10000);
+    }
+    CHECK(graph.getTotalUs() < 90000);
+}
@@ -0,0 +1,77 @@
+// Runs the host tests. Build and run with `make test` from the project root.
+
+#include "vex.h"
+#include "testing.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+// Defined in main.cpp, which is not part of the host build.
+std::string Version = "host";
+std::string BuildDate = "host";
+
+std::uint64_t VirtualClock::nowUs = 0;
+
+struct TestCase
+{
+    const char *name;
+    TestFunction function;
+};
+
+static std::vector<TestCase> &testCases()
+{
+    static std::vector<TestCase> cases;
+    return cases;
+}
+
+static int failures = 0;
+
+bool registerTest(const char *name, TestFunction function)
+{
+    testCases().push_back(TestCase{name, function});
+    return true;
+}
+
+void reportFailure(const char *file, int line, const std::string &expression)
+{
+    ++failures;
+    std::printf("  %s:%d: CHECK failed: %s\n", file, line, expression.c_str());
+}
+
+bool bootFromText(configManager &config, const char *fileName, const std::string &text)
+{
+    std::filesystem::remove("config.bin");
+    std::ofstream(fileName, std::ios::binary | std::ios::trunc) << text;
+    clearLoggedMessages();
+    config.parseConfig();
+    return std::ranges::none_of(loggedMessages(), [](const LoggedMessage &message)
+                                { return message.level >= Log::Level::Warn; });
+}
+
+int main(int argc, char **argv)
+{
+    const char *filter = argc > 1 ? argv[1] : nullptr;
+    int run = 0;
+    int failedCases = 0;
+    for (const TestCase &test : testCases())
+    {
+        if (filter && !std::strstr(test.name, filter))
+        {
+            continue;
+        }
+        const int failuresBefore = failures;
+        vex::host::resetDevices();
+        clearLoggedMessages();
+        test.function();
+        ++run;
+        if (failures != failuresBefore)
+        {
+            ++failedCases;
+            std::printf("FAIL %s\n", test.name);
+        }
+    }
+    std::printf("%d of %d tests passed.\n", run - failedCases, run);
+    return failedCases == 0 ? 0 : 1;
+}
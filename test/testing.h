@@ -0,0 +1,85 @@
+#ifndef TESTING_H
+#define TESTING_H
+
+#include <cmath>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Minimal test registry for the host tests.
+ *
+ * TEST(name) defines a test case; CHECK and CHECK_NEAR record a failure and carry on so one run
+ * reports every broken expectation. testMain.cpp runs all registered cases, or those whose name
+ * contains the first command line argument.
+ */
+
+using TestFunction = void (*)();
+
+bool registerTest(const char *name, TestFunction function);
+void reportFailure(const char *file, int line, const std::string &expression);
+
+#define TEST(name)                                                  \
+    static void name();                                             \
+    static const bool name##Registered = registerTest(#name, name); \
+    static void name()
+
+#define CHECK(condition)                                    \
+    do                                                      \
+    {                                                       \
+        if (!(condition))                                   \
+        {                                                   \
+            reportFailure(__FILE__, __LINE__, #condition);  \
+        }                                                   \
+    } while (false)
+
+#define CHECK_NEAR(actual, expected, tolerance)                                                                            \
+    do                                                                                                                     \
+    {                                                                                                                      \
+        const double checkActual = (actual);                                                                               \
+        const double checkExpected = (expected);                                                                           \
+        if (!(std::abs(checkActual - checkExpected) <= (tolerance)))                                                       \
+        {                                                                                                                  \
+            reportFailure(__FILE__, __LINE__, std::string(#actual) + " = " + std::to_string(checkActual) + ", expected " + \
+                                                  std::to_string(checkExpected) + " +- " + std::to_string(tolerance));     \
+        }                                                                                                                  \
+    } while (false)
+
+/**
+ * @struct LoggedMessage
+ * @brief A logHandler() call captured by the host log sink.
+ */
+struct LoggedMessage
+{
+    std::string functionName;
+    std::string message;
+    Log::Level level;
+    float timeOfDisplay;
+    std::thread::id thread;
+};
+
+std::vector<LoggedMessage> loggedMessages();
+void clearLoggedMessages();
+
+/**
+ * @brief Boots `config` from `text` with parseConfig(), so the parsed devices and live settings
+ *        are published. `text` is written to `fileName`, the config's file, and any snapshot is
+ *        removed first.
+ *
+ * @return true if the boot logged nothing at Warn or above.
+ */
+bool bootFromText(configManager &config, const char *fileName, const std::string &text);
+
+/**
+ * @brief Virtual microsecond clock for PeriodicScheduler::Clock users. sleepUntil() jumps ahead.
+ */
+struct VirtualClock
+{
+    static std::uint64_t nowUs;
+
+    static std::uint64_t now() { return nowUs; }
+    static void sleepUntil(std::uint64_t deadline) { nowUs = std::max(nowUs, deadline); }
+    static PeriodicScheduler::Clock clock() { return PeriodicScheduler::Clock{now, sleepUntil}; }
+};
+
+#endif // TESTING_H
@@ -0,0 +1,245 @@
+#include "vex.h"
+#include "testing.h"
+#include "drivetrainSim.h"
+
+static DrivetrainSim::Settings slipperyFloor()
+{
+    DrivetrainSim::Settings settings;
+    settings.peakGrip = 0.35;
+    settings.slidingGrip = 0.2;
+    return settings;
+}
+
+static TractionControl::Inputs tractionInputs(const SensorFrame &frame, double dtSeconds)
+{
+    TractionControl::Inputs inputs;
+    for (std::size_t i = 0; i < WheelCount; ++i)
+    {
+        inputs.wheelRpm[i] = frame.wheels[i].velocityRpm;
+    }
+    inputs.forwardAccelG = frame.forwardAccelG;
+    inputs.yawRateDps = frame.yawRateDps;
+    inputs.dtSeconds = dtSeconds;
+    return inputs;
+}
+
+static AntiLockBraking::Inputs absInputs(const SensorFrame &frame, double dtSeconds)
+{
+    AntiLockBraking::Inputs inputs;
+    for (std::size_t i = 0; i < WheelCount; ++i)
+    {
+        inputs.wheelRpm[i] = frame.wheels[i].velocityRpm;
+    }
+    inputs.forwardAccelG = frame.forwardAccelG;
+    inputs.yawRateDps = frame.yawRateDps;
+    inputs.dtSeconds = dtSeconds;
+    return inputs;
+}
+
+static double rpmFor(double metersPerSecond)
+{
+    return metersPerSecond / (wheelTravelMm / 1000.0) * 60;
+}
+
+// Rolls every wheel at `metersPerSecond` until the speed estimate has settled.
+static AntiLockBraking::Inputs warmUp(AntiLockBraking &antiLock, double metersPerSecond)
+{
+    AntiLockBraking::Inputs inputs;
+    inputs.wheelRpm.fill(rpmFor(metersPerSecond));
+    inputs.dtSeconds = 0.01;
+    for (int tick = 0; tick < 100; ++tick)
+    {
+        WheelVolts volts = WheelVolts::fromSides(6, 6);
+        antiLock.apply(volts, inputs);
+    }
+    return inputs;
+}
+
+struct RunResult
+{
+    double meanSlip = 0;
+    double distance = 0;
+    double finalSpeed = 0;
+};
+
+// Full throttle from standstill on a slippery floor for one second.
+static RunResult launch(bool tractionOn)
+{
+    DrivetrainSim sim(slipperyFloor());
+    TractionControl traction;
+    const double dt = 0.01;
+    RunResult result;
+    for (int tick = 0; tick < 100; ++tick)
+    {
+        WheelVolts volts = WheelVolts::fromSides(12, 12);
+        if (tractionOn)
+        {
+            traction.apply(volts, tractionInputs(sim.frame(), dt));
+        }
+        sim.step(volts, dt);
+        result.meanSlip += sim.wheelSlip(0) / 100;
+    }
+    result.distance = sim.position;
+    result.finalSpeed = sim.speed;
+    return result;
+}
+
+// Full reverse stick at speed on a slippery floor until the robot stops.
+static RunResult brake(bool absOn)
+{
+    DrivetrainSim sim(slipperyFloor());
+    sim.setSpeed(0.9);
+    AntiLockBraking antiLock;
+    const double dt = 0.01;
+    RunResult result;
+    int ticks = 0;
+    // Rolling at speed before the driver brakes, so the speed estimate has settled.
+    for (int tick = 0; tick < 30; ++tick)
+    {
+        WheelVolts volts = WheelVolts::fromSides(10.2, 10.2);
+        antiLock.apply(volts, absInputs(sim.frame(), dt));
+        sim.step(volts, dt);
+    }
+    const double start = sim.position;
+    while (sim.speed > 0.02 && ticks < 300)
+    {
+        WheelVolts volts = WheelVolts::fromSides(-12, -12);
+        if (absOn)
+        {
+            antiLock.apply(volts, absInputs(sim.frame(), dt));
+        }
+        sim.step(volts, dt);
+        result.meanSlip += sim.wheelSlip(0);
+        ++ticks;
+    }
+    result.meanSlip /= ticks;
+    result.distance = sim.position - start;
+    result.finalSpeed = sim.speed;
+    return result;
+}
+
+TEST(tractionControlCutsWheelspinOnLaunch)
+{
+    const RunResult off = launch(false);
+    const RunResult on = launch(true);
+    std::printf("  launch: slip %.3f off / %.3f on, distance %.3f / %.3f m\n", off.meanSlip, on.meanSlip, off.distance, on.distance);
+    CHECK(on.meanSlip < off.meanSlip / 2);
+    CHECK(on.distance >= off.distance * 0.95);
+}
+
+TEST(antiLockBrakingStopsShorterWithoutLocking)
+{
+    const RunResult off = brake(false);
+    const RunResult on = brake(true);
+    std::printf("  braking: slip %.3f off / %.3f on, distance %.3f / %.3f m\n", off.meanSlip, on.meanSlip, off.distance, on.distance);
+    CHECK(on.meanSlip < off.meanSlip / 2);
+    CHECK(on.distance < off.distance);
+    CHECK(on.finalSpeed <= 0.02);
+}
+
+TEST(antiLockBrakingLeavesDrivingAndRollingWheelsAlone)
+{
+    AntiLockBraking antiLock;
+    AntiLockBraking::Inputs inputs = warmUp(antiLock, 0.5);
+
+    WheelVolts driving = WheelVolts::fromSides(12, 12);
+    antiLock.apply(driving, inputs);
+    for (double volts : driving.volts)
+    {
+        CHECK_NEAR(volts, 12, 1e-9);
+    }
+
+    // Reverse voltage on wheels that still roll with the ground is ordinary braking.
+    WheelVolts braking = WheelVolts::fromSides(-12, -12);
+    antiLock.apply(braking, inputs);
+    for (double volts : braking.volts)
+    {
+        CHECK_NEAR(volts, -12, 1e-9);
+    }
+    CHECK_NEAR(antiLock.getSlip(Wheel::FrontLeft), 0, 1e-9);
+}
+
+TEST(antiLockBrakingReleasesOnlyTheLockedWheel)
+{
+    AntiLockBraking antiLock;
+    AntiLockBraking::Inputs inputs = warmUp(antiLock, 0.5);
+
+    inputs.wheelRpm[static_cast<std::size_t>(Wheel::FrontLeft)] = 0;
+    WheelVolts volts = WheelVolts::fromSides(-12, -12);
+    antiLock.apply(volts, inputs);
+    CHECK(antiLock.getSlip(Wheel::FrontLeft) > 0.9);
+    CHECK(antiLock.getScale(Wheel::FrontLeft) < 0.1);
+    // Released to about the voltage that keeps the wheel rolling, not cut to 0 V, which still brakes on back-EMF.
+    CHECK(volts.volts[static_cast<std::size_t>(Wheel::FrontLeft)] > 0);
+    CHECK_NEAR(volts.volts[static_cast<std::size_t>(Wheel::RearLeft)], -12, 1e-9);
+    CHECK_NEAR(volts.volts[static_cast<std::size_t>(Wheel::FrontRight)], -12, 1e-9);
+    CHECK_NEAR(volts.volts[static_cast<std::size_t>(Wheel::RearRight)], -12, 1e-9);
+
+    // Once the wheel rolls again the braking effort comes back gradually.
+    inputs.wheelRpm.fill(rpmFor(0.5));
+    volts = WheelVolts::fromSides(-12, -12);
+    antiLock.apply(volts, inputs);
+    const double reapplied = antiLock.getScale(Wheel::FrontLeft);
+    CHECK(reapplied < 0.2);
+    for (int tick = 0; tick < 30; ++tick)
+    {
+        volts = WheelVolts::fromSides(-12, -12);
+        antiLock.apply(volts, inputs);
+    }
+    CHECK_NEAR(antiLock.getScale(Wheel::FrontLeft), 1, 1e-9);
+    CHECK_NEAR(volts.volts[static_cast<std::size_t>(Wheel::FrontLeft)], -12, 1e-9);
+}
+
+TEST(antiLockBrakingIgnoresAStandingRobot)
+{
+    AntiLockBraking antiLock;
+    AntiLockBraking::Inputs inputs;
+    inputs.dtSeconds = 0.01;
+    WheelVolts volts = WheelVolts::fromSides(-12, 12);
+    antiLock.apply(volts, inputs);
+    CHECK_NEAR(volts.volts[0], -12, 1e-9);
+    CHECK_NEAR(volts.volts[2], 12, 1e-9);
+}
+
+TEST(tractionControlLeavesBrakingToAntiLock)
+{
+    TractionControl traction;
+    TractionControl::Inputs inputs;
+    inputs.wheelRpm.fill(rpmFor(0.5));
+    inputs.dtSeconds = 0.01;
+    for (int tick = 0; tick < 100; ++tick)
+    {
+        WheelVolts volts = WheelVolts::fromSides(6, 6);
+        traction.apply(volts, inputs);
+    }
+
+    // Wheels spun backwards by reverse voltage while the robot still moves forward.
+    inputs.wheelRpm.fill(rpmFor(-0.5));
+    WheelVolts volts = WheelVolts::fromSides(-12, -12);
+    traction.apply(volts, inputs);
+    CHECK_NEAR(traction.getScale(Wheel::FrontLeft), 1, 1e-9);
+    CHECK_NEAR(volts.volts[0], -12, 1e-9);
+}
+
+// Regression: ABS used to replace the forward command with the slowest wheel speed, so a
+// standing robot ignored the stick.
+TEST(driveSystemFollowsFullStickFromStandstill)
+{
+    Devices.begin();
+    DriveSystem drive(10);
+    SensorFrame frame;
+    frame.sticks.axes = {0, 100, 100, 0}; // Full forward in every drive mode.
+    for (configManager::DriveMode mode : {configManager::DriveMode::LeftArcade, configManager::DriveMode::RightArcade, configManager::DriveMode::SplitArcade, configManager::DriveMode::Tank})
+    {
+        drive.configure(mode);
+        WheelVolts volts;
+        for (int tick = 0; tick < 200; ++tick)
+        {
+            volts = drive.compute(frame);
+        }
+        for (double wheel : volts.volts)
+        {
+            CHECK(wheel > 11.5);
+        }
+    }
+}
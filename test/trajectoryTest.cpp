@@ -0,0 +1,165 @@
+#include "vex.h"
+#include "testing.h"
+#include "drivetrainSim.h"
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+
+// Float samples: limits hold to a little more than float rounding.
+static constexpr double sampleTolerance = 1e-3;
+
+static double sampleSpacing(const TrajectorySample &a, const TrajectorySample &b)
+{
+    return std::hypot(b.x - a.x, b.y - a.y);
+}
+
+TEST(trajectoryRespectsItsLimits)
+{
+    TrajectoryConstraints constraints;
+    constraints.maxVelocity = 1.2;
+    constraints.maxAcceleration = 1.5;
+    constraints.maxLateralAcceleration = 1.0;
+    const Trajectory trajectory = Trajectory::generate({{0, 0}, {1, 0}, {1.5, 0.8}, {0.8, 1.4}}, constraints);
+    const std::vector<TrajectorySample> &samples = trajectory.getSamples();
+    CHECK(samples.size() > 100);
+    CHECK(samples.front().velocity == 0);
+    CHECK(samples.back().velocity == 0);
+    CHECK_NEAR(samples.back().x, 0.8, 1e-6);
+    CHECK_NEAR(samples.back().y, 1.4, 1e-6);
+
+    double peakVelocity = 0;
+    for (std::size_t i = 0; i < samples.size(); ++i)
+    {
+        const TrajectorySample &sample = samples[i];
+        peakVelocity = std::max(peakVelocity, static_cast<double>(sample.velocity));
+        CHECK(sample.velocity <= constraints.maxVelocity + sampleTolerance);
+        CHECK(sample.velocity * sample.velocity * std::abs(sample.curvature) <= constraints.maxLateralAcceleration + sampleTolerance);
+        if (i > 0)
+        {
+            const TrajectorySample &previous = samples[i - 1];
+            const double ds = sampleSpacing(previous, sample);
+            CHECK(ds <= constraints.sampleSpacing * 1.5);
+            CHECK(sample.time >= previous.time);
+            // v^2 = u^2 + 2as, both speeding up and slowing down.
+            const double acceleration = std::abs(sample.velocity * sample.velocity - previous.velocity * previous.velocity) / (2 * ds);
+            CHECK(acceleration <= constraints.maxAcceleration + sampleTolerance * 10);
+        }
+    }
+    // The straight first metre is long enough to reach the velocity limit.
+    CHECK_NEAR(peakVelocity, constraints.maxVelocity, sampleTolerance);
+    CHECK(trajectory.getDuration() > 0);
+}
+
+TEST(trajectoryNeedsTwoWaypoints)
+{
+    const Trajectory trajectory = Trajectory::generate({{0, 0}}, TrajectoryConstraints{});
+    CHECK(!trajectory.isReady());
+    CHECK(!loggedMessages().empty());
+}
+
+TEST(trajectoryCacheRoundTripsAndRejectsOtherInputs)
+{
+    const std::vector<Waypoint> waypoints = {{0, 0}, {0.6, 0}, {1.2, 0.6}};
+    const TrajectoryConstraints constraints;
+    const Trajectory generated = Trajectory::generate(waypoints, constraints);
+    const std::uint32_t hash = Trajectory::hashInputs(waypoints, constraints);
+    CHECK(generated.getHash() == hash);
+    CHECK(generated.save("route.bin"));
+
+    Trajectory loaded;
+    CHECK(loaded.load("route.bin", hash));
+    CHECK(loaded.getHash() == hash);
+    CHECK(loaded.getSamples().size() == generated.getSamples().size());
+    CHECK(std::memcmp(loaded.getSamples().data(), generated.getSamples().data(), generated.getSamples().size() * sizeof(TrajectorySample)) == 0);
+
+    // A moved waypoint or a changed limit gives another hash, and the cache is not used.
+    std::vector<Waypoint> moved = waypoints;
+    moved[2].y = 0.7;
+    TrajectoryConstraints slower = constraints;
+    slower.maxVelocity = 1.0;
+    CHECK(Trajectory::hashInputs(moved, constraints) != hash);
+    CHECK(Trajectory::hashInputs(waypoints, slower) != hash);
+    Trajectory stale;
+    CHECK(!stale.load("route.bin", Trajectory::hashInputs(moved, constraints)));
+    CHECK(!stale.load("route.bin", Trajectory::hashInputs(waypoints, slower)));
+    CHECK(!stale.isReady());
+
+    std::filesystem::resize_file("route.bin", std::filesystem::file_size("route.bin") - sizeof(TrajectorySample) / 2);
+    CHECK(!stale.load("route.bin", hash));
+    CHECK(!stale.load("missing.bin", hash));
+}
+
+// The default drive motors: 600 rpm cartridges driving the wheels directly.
+static DrivetrainSim::Settings blueCartridgeDrive()
+{
+    DrivetrainSim::Settings settings;
+    settings.freeRpm = 600;
+    settings.stallTorqueNm = 0.7;
+    settings.wheelInertia = 0.001;
+    return settings;
+}
+
+/**
+ * Runs PurePursuit and the velocity loops against the drivetrain sim, like followTrajectory()
+ * does on the robot, with the pose integrated from the sim's chassis.
+ */
+static FollowResult followInSim(const Trajectory &trajectory)
+{
+    constexpr double dt = 0.01;
+    const double rpmPerMeterPerSecond = 60.0 / (wheelTravelMm / 1000.0);
+
+    // The sim has no static friction for kS to overcome.
+    configManager::VelocityGains gains;
+    gains.kS = 0;
+    DrivetrainSim sim(blueCartridgeDrive());
+    VelocityController left(gains);
+    VelocityController right(gains);
+    PurePursuit follower;
+
+    const TrajectorySample &start = trajectory.getSamples().front();
+    Pose pose;
+    pose.x = start.x;
+    pose.y = start.y;
+    pose.theta = start.heading;
+    sim.heading = -start.heading; // The sim turns positive to the right.
+
+    FollowResult result;
+    double errorSum = 0;
+    int ticks = 0;
+    while (ticks * dt <= trajectory.getDuration() + 2.0)
+    {
+        const PurePursuit::Output output = follower.update(pose, trajectory);
+        ++ticks;
+        errorSum += std::abs(output.crossTrackError);
+        result.maxCrossTrackError = std::max(result.maxCrossTrackError, std::abs(output.crossTrackError));
+        if (output.finished)
+        {
+            result.completed = true;
+            break;
+        }
+
+        const SensorFrame frame = sim.frame();
+        const double leftVolts = left.update(output.leftVelocity * rpmPerMeterPerSecond, frame.leftVelocityRpm(), dt);
+        const double rightVolts = right.update(output.rightVelocity * rpmPerMeterPerSecond, frame.rightVelocityRpm(), dt);
+        sim.step(WheelVolts::fromSides(leftVolts, rightVolts), dt);
+
+        pose.theta = -sim.heading;
+        pose.x += sim.speed * std::cos(pose.theta) * dt;
+        pose.y += sim.speed * std::sin(pose.theta) * dt;
+    }
+    result.elapsedSeconds = ticks * dt;
+    result.meanCrossTrackError = errorSum / ticks;
+    return result;
+}
+
+TEST(purePursuitFollowsTheDefaultRoute)
+{
+    const Trajectory route = Trajectory::generate(autonomousWaypoints, TrajectoryConstraints{});
+    const FollowResult result = followInSim(route);
+    std::printf("  default route: %.2f s of %.2f s, cross-track error mean %.1f cm, max %.1f cm\n",
+                result.elapsedSeconds, route.getDuration(), result.meanCrossTrackError * 100, result.maxCrossTrackError * 100);
+    CHECK(result.completed);
+    CHECK(result.elapsedSeconds < route.getDuration() + 1.0);
+    CHECK(result.meanCrossTrackError < 0.04);
+    CHECK(result.maxCrossTrackError < 0.10);
+}
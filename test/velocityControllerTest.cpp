@@ -0,0 +1,106 @@
+#include "vex.h"
+#include "testing.h"
+#include "drivetrainSim.h"
+
+// The default drive motors: 600 rpm cartridges driving the wheels directly.
+static DrivetrainSim::Settings blueCartridgeDrive()
+{
+    DrivetrainSim::Settings settings;
+    settings.freeRpm = 600;
+    settings.stallTorqueNm = 0.7;
+    settings.wheelInertia = 0.001;
+    return settings;
+}
+
+// Default gains without kS: the sim has no static friction for it to overcome.
+static configManager::VelocityGains gainsForSim()
+{
+    configManager::VelocityGains gains;
+    gains.kS = 0;
+    return gains;
+}
+
+struct StepResponse
+{
+    double settlingSeconds = -1; ///< Time until the speed stays within 5 % of the target.
+    double overshoot = 0;        ///< Peak above the target, as a fraction of the target.
+    double finalRpm = 0;
+};
+
+static StepResponse stepResponse(double targetRpm, double seconds, const configManager::VelocityGains &gains)
+{
+    DrivetrainSim sim(blueCartridgeDrive());
+    VelocityController left(gains);
+    VelocityController right(gains);
+    const double dt = 0.01;
+    StepResponse response;
+    double peak = 0;
+    for (int tick = 0; tick * dt < seconds; ++tick)
+    {
+        const SensorFrame frame = sim.frame();
+        const double leftVolts = left.update(targetRpm, frame.leftVelocityRpm(), dt);
+        const double rightVolts = right.update(targetRpm, frame.rightVelocityRpm(), dt);
+        sim.step(WheelVolts::fromSides(leftVolts, rightVolts), dt);
+
+        const double rpm = sim.frame().leftVelocityRpm();
+        peak = std::max(peak, rpm);
+        if (std::abs(rpm - targetRpm) > 0.05 * targetRpm)
+        {
+            response.settlingSeconds = -1;
+        }
+        else if (response.settlingSeconds < 0)
+        {
+            response.settlingSeconds = (tick + 1) * dt;
+        }
+    }
+    response.overshoot = std::max(0.0, peak - targetRpm) / targetRpm;
+    response.finalRpm = sim.frame().leftVelocityRpm();
+    return response;
+}
+
+TEST(velocityStepSettlesWithoutOvershoot)
+{
+    const StepResponse response = stepResponse(300, 2, gainsForSim());
+    std::printf("  step to 300 rpm: settled in %.2f s, overshoot %.1f %%\n", response.settlingSeconds, response.overshoot * 100);
+    CHECK(response.settlingSeconds > 0);
+    CHECK(response.settlingSeconds < 0.5);
+    CHECK(response.overshoot < 0.05);
+    CHECK_NEAR(response.finalRpm, 300, 6);
+}
+
+TEST(velocityIntegralRemovesModelError)
+{
+    // Feedforward 25 % low, as on a worn drivetrain: the integrator makes up the difference.
+    configManager::VelocityGains gains = gainsForSim();
+    gains.kV *= 0.75;
+    const StepResponse response = stepResponse(300, 3, gains);
+    std::printf("  step with weak kV: settled in %.2f s, overshoot %.1f %%\n", response.settlingSeconds, response.overshoot * 100);
+    CHECK(response.settlingSeconds > 0);
+    CHECK(response.overshoot < 0.05);
+    CHECK_NEAR(response.finalRpm, 300, 6);
+}
+
+TEST(velocityIntegratorDoesNotWindUpWhileStalled)
+{
+    VelocityController controller;
+    // Pinned against a wall at full command for two seconds.
+    for (int tick = 0; tick < 200; ++tick)
+    {
+        controller.update(500, 0, 0.01);
+    }
+    CHECK(controller.isSaturated());
+    CHECK(std::abs(controller.getIntegral()) < 0.5);
+
+    // Freed at the target speed, the output is back near the feedforward straight away.
+    const double volts = controller.update(500, 500, 0.01);
+    CHECK_NEAR(volts, 0.3 + 0.02 * 500, 0.5);
+    CHECK(!controller.isSaturated());
+}
+
+TEST(velocityOutputSaturatesAtMaxVolts)
+{
+    VelocityController controller(configManager::VelocityGains{}, 8);
+    CHECK_NEAR(controller.update(600, 0, 0.01), 8, 1e-9);
+    CHECK_NEAR(controller.update(-600, 0, 0.01), -8, 1e-9);
+    CHECK_NEAR(controller.update(0, 0, 0), 0, 1e-9);
+}